@@ -41,7 +41,8 @@ namespace io {
 /**
  * takes the network graph file path from the options, reads the edge list and adds the information into a new MultiLayeredGraph
  * @param network_path path to the network graph file
- * @return new MultiLayeredGraph with the network links present
+ * @return new MultiLayeredGraph with the network links present, std::nullopt if the file can not be opened
+ * @throws std::overflow_error if a node id does not fit into the id type
  */
 [[nodiscard]] inline auto parseNetworkGraph(const std::string& network_path) -> std::optional<MultiLayeredGraph>
 {
@@ -62,8 +63,8 @@ namespace io {
             continue;
         }
         std::string_view temp_sv{line};
-        common::NetworkNodeID node1{extractNextIntegerFromLine(temp_sv)};
-        common::NetworkNodeID node2{extractNextIntegerFromLine(temp_sv)};
+        common::NetworkNodeID node1{common::checkedNarrow<common::UnderlyingID>(extractNextIntegerFromLine(temp_sv), "node id")};
+        common::NetworkNodeID node2{common::checkedNarrow<common::UnderlyingID>(extractNextIntegerFromLine(temp_sv), "node id")};
 
         // fmt::print("{} - {}\n", node1.get(), node2.get());
         if(adjacency_list.size() < std::max(node1, node2).get() + 1) {
@@ -99,7 +100,7 @@ inline auto parseScenario(const std::string& scenario_path) -> std::vector<TimeS
         TimeStep t;
         t.time = time_step["time"].get<std::size_t>();
         for(const auto& remove_entry : time_step["removeFlows"]) {
-            t.remove_flows.emplace_back(remove_entry.get<std::size_t>());
+            t.remove_flows.emplace_back(common::checkedNarrow<common::UnderlyingID>(remove_entry.get<std::size_t>(), "flow id"));
         }
 
         for(const auto& add_entry : time_step["addFlows"]) {
@@ -108,6 +109,11 @@ inline auto parseScenario(const std::string& scenario_path) -> std::vector<TimeS
         scenario.emplace_back(std::move(t));
     }
 
+#ifdef COMPACT_TYPES
+    // all ticks are within the hyper cycle
+    common::checkFits<common::Tick>(util::calculate_hyper_cycle(scenario), "hyper cycle");
+#endif
+
     return scenario;
 }
 
@@ -15,6 +15,7 @@ struct MetaDataLog
     std::size_t max_queue_size;
     float avg_scheduling_table_size;
     std::size_t max_scheduling_table_size;
+    bool budget_hit = false;
 };
 
 /**
@@ -24,7 +25,7 @@ struct MetaDataLog
  */
 inline auto meta_data_log_to_raw_string(const MetaDataLog &log)
 {
-    return fmt::format("{}\t{}\t{}\t{}\t{}\t{}\t{}\t{}\t{}\t{}",
+    return fmt::format("{}\t{}\t{}\t{}\t{}\t{}\t{}\t{}\t{}\t{}\t{}",
                        log.planning_mode,
                        log.flows_scheduled,
                        log.flows_total,
@@ -34,7 +35,8 @@ inline auto meta_data_log_to_raw_string(const MetaDataLog &log)
                        log.config_time,
                        log.max_queue_size,
                        log.avg_scheduling_table_size,
-                       log.max_scheduling_table_size);
+                       log.max_scheduling_table_size,
+                       log.budget_hit);
 }
 
 /**
@@ -56,7 +58,8 @@ inline auto meta_data_log_to_pretty_string(const MetaDataLog &log) -> std::strin
         "Configuration time [s]: {}\n"
         "Maximum queue size required: {}\n"
         "Average scheduling table length: {}\n"
-        "Maximum scheduling table length: {}",
+        "Maximum scheduling table length: {}\n"
+        "Step budget exceeded: {}",
         log.planning_mode,
         log.flows_scheduled,
         log.flows_total,
@@ -66,7 +69,8 @@ inline auto meta_data_log_to_pretty_string(const MetaDataLog &log) -> std::strin
         log.config_time,
         log.max_queue_size,
         log.avg_scheduling_table_size,
-        log.max_scheduling_table_size);
+        log.max_scheduling_table_size,
+        log.budget_hit);
 }
 
 } // namespace io
\ No newline at end of file
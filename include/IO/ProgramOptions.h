@@ -3,6 +3,7 @@
 #include "solver/Placement.h"
 #include <solver/FlowSorting/FlowSorterFactory.h>
 #include <string>
+#include <vector>
 
 
 class ProgramOptions
@@ -20,7 +21,15 @@ public:
     auto isUseOffensivePlanning() const -> bool;
     auto getPlacementType() const -> placement::ConfigPlacementTypes;
     auto getCandidatePaths() const -> std::size_t;
+    auto isLazyCandidatePaths() const -> bool;
     auto isVerifySchedule() const -> bool;
+    auto isEdfBatchAdmission() const -> bool;
+    auto getNumberOfThreads() const -> std::size_t;
+    auto getPortfolio() const -> const std::vector<std::string>&;
+    auto getStepBudget() const -> std::size_t;
+    auto getCongestionWeight() const -> std::size_t;
+    auto isPrecomputeRoutes() const -> bool;
+    auto getRouteTablePath() const -> const std::string&;
 
 private:
     std::string network_path_;
@@ -30,8 +39,16 @@ private:
     std::string routing_algorithm_ = "DIJKSTRA_OVERLAP";
     std::size_t configuration_rating_ = 1;
     std::size_t candidate_paths_ = 5;
+    bool lazy_candidate_paths_ = false;
     flow_sorting::FlowSorterTypes flow_sorting_ = flow_sorting::FlowSorterTypes::LOW_PERIOD_FLOWS_FIRST;
     bool use_offensive_planning_ = false;
     placement::ConfigPlacementTypes placement_type_ = placement::ConfigPlacementTypes::BALANCED;
     bool verify_schedule = false;
+    bool edf_batch_admission_ = false;
+    std::size_t number_of_threads_ = 1;
+    std::vector<std::string> portfolio_;
+    std::size_t step_budget_ms_ = 0;
+    std::size_t congestion_weight_ = 10;
+    bool precompute_routes_ = false;
+    std::string route_table_path_;
 };
\ No newline at end of file
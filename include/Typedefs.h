@@ -1,15 +1,59 @@
 #pragma once
 
 #include <NamedType/named_type.hpp>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
 
 namespace common {
 
-using NetworkNodeID = fluent::NamedType<std::size_t, struct NetworkNodeIDTag, fluent::Hashable, fluent::Comparable, fluent::Addable, fluent::Multiplicable, fluent::Incrementable>;
+#ifdef COMPACT_TYPES
+// halves the memory footprint of the graph and the utilization lists, see the COMPACT_TYPES build option
+using UnderlyingID = std::uint32_t;
+using Tick = std::uint32_t;
+#else
+using UnderlyingID = std::size_t;
+using Tick = std::size_t;
+#endif
 
-using NetworkQueueID = fluent::NamedType<std::size_t, struct NetworkQueueIDTag, fluent::Hashable, fluent::Comparable, fluent::Addable, fluent::Multiplicable, fluent::Incrementable>;
+/**
+ * checks that a parsed value fits into the (possibly compact) type T
+ * @param value
+ * @param name used in the error message
+ * @throws std::overflow_error if value does not fit into T
+ */
+template<class T>
+auto checkFits(const std::size_t value, const std::string& name) -> void
+{
+    if(value > std::numeric_limits<T>::max()) {
+        throw std::overflow_error(name + " " + std::to_string(value) + " exceeds the maximum of " + std::to_string(std::numeric_limits<T>::max())
+                                  + ", build without COMPACT_TYPES");
+    }
+}
 
-using ConfigurationNodeID = fluent::NamedType<std::size_t, struct ConfigurationNodeIDTag, fluent::Hashable, fluent::Comparable, fluent::Addable, fluent::Multiplicable, fluent::Incrementable>;
+/**
+ * converts a parsed value into the (possibly compact) type T
+ * @param value
+ * @param name used in the error message
+ * @return value as T
+ * @throws std::overflow_error if value does not fit into T
+ */
+template<class T>
+[[nodiscard]] auto checkedNarrow(const std::size_t value, const std::string& name) -> T
+{
+    checkFits<T>(value, name);
+    return static_cast<T>(value);
+}
 
-using FlowNodeID = fluent::NamedType<std::size_t, struct FlowNodeIDTag, fluent::Hashable, fluent::Comparable, fluent::Addable, fluent::Multiplicable, fluent::Incrementable>;
+using NetworkNodeID = fluent::NamedType<UnderlyingID, struct NetworkNodeIDTag, fluent::Hashable, fluent::Comparable, fluent::Addable, fluent::Multiplicable, fluent::Incrementable>;
+
+using NetworkQueueID = fluent::NamedType<UnderlyingID, struct NetworkQueueIDTag, fluent::Hashable, fluent::Comparable, fluent::Addable, fluent::Multiplicable, fluent::Incrementable>;
+
+using ConfigurationNodeID = fluent::NamedType<UnderlyingID, struct ConfigurationNodeIDTag, fluent::Hashable, fluent::Comparable, fluent::Addable, fluent::Multiplicable, fluent::Incrementable>;
+
+using FlowNodeID = fluent::NamedType<UnderlyingID, struct FlowNodeIDTag, fluent::Hashable, fluent::Comparable, fluent::Addable, fluent::Multiplicable, fluent::Incrementable>;
+
+using PathID = fluent::NamedType<UnderlyingID, struct PathIDTag, fluent::Hashable, fluent::Comparable>;
 
 } // namespace common
@@ -3,6 +3,7 @@
 #include <Typedefs.h>
 #include <nlohmann/detail/macro_scope.hpp>
 #include <nlohmann/json.hpp>
+#include <span>
 
 using json = nlohmann::json;
 
@@ -38,13 +39,13 @@ struct Flow
 {
     std::size_t temp;
     j.at("flowID").get_to(temp);
-    f.id = common::FlowNodeID{temp};
+    f.id = common::FlowNodeID{common::checkedNarrow<common::UnderlyingID>(temp, "flow id")};
     j.at("package size").get_to(f.frame_size);
     j.at("period").get_to(f.period);
     j.at("source").get_to(temp);
-    f.source = common::NetworkNodeID{temp};
+    f.source = common::NetworkNodeID{common::checkedNarrow<common::UnderlyingID>(temp, "source node id")};
     j.at("destination").get_to(temp);
-    f.destination = common::NetworkNodeID{temp};
+    f.destination = common::NetworkNodeID{common::checkedNarrow<common::UnderlyingID>(temp, "destination node id")};
 }
 
 struct Configuration
@@ -52,14 +53,17 @@ struct Configuration
     // note that the ConfigurationID is only unique within the Flow
     common::ConfigurationNodeID id;
     common::FlowNodeID flow;
-    std::vector<common::NetworkQueueID> path;
+    // the hops of configurations inside a MultiLayeredGraph live in its path pool and move when the pool is compacted
+    std::span<const common::NetworkQueueID> path;
+    // configurations with identical hops share the interned path of the MultiLayeredGraph
+    common::PathID path_id{0};
 };
 
+// only the topology is stored here to keep the csr dense for routing, the users are kept in the MultiLayeredGraph
 struct EgressQueue
 {
     common::NetworkQueueID id;
     common::NetworkNodeID destination;
-    std::vector<common::ConfigurationNodeID> used_by;
     bool end_device;
     // utilization information
     // queueing decisions
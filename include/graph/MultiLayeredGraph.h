@@ -2,6 +2,7 @@
 
 #include <Typedefs.h>
 #include <graph/GraphStructs.h>
+#include <graph/SlotMap.h>
 #include <memory>
 #include <span>
 #include <string>
@@ -13,22 +14,58 @@ class MultiLayeredGraph
 public:
     MultiLayeredGraph();
 
+    /**
+     * copies the graph and relinks the paths, so that the copied configurations refer to the hops of the copy
+     * @param other
+     */
+    MultiLayeredGraph(const MultiLayeredGraph& other);
+
+    MultiLayeredGraph(MultiLayeredGraph&& other) noexcept = default;
+
+    auto operator=(const MultiLayeredGraph& other) -> MultiLayeredGraph&;
+
+    auto operator=(MultiLayeredGraph&& other) noexcept -> MultiLayeredGraph& = default;
+
+    ~MultiLayeredGraph() = default;
+
     [[nodiscard]] auto getNumberOfFlows() const -> std::size_t;
 
     [[nodiscard]] auto getFlow(common::FlowNodeID flow_id) -> graph_structs::Flow&;
 
     [[nodiscard]] auto getFlow(common::FlowNodeID flow_id) const -> const graph_structs::Flow&;
 
-    [[nodiscard]] auto getFlows() const -> const robin_hood::unordered_map<common::FlowNodeID, graph_structs::Flow>&;
+    [[nodiscard]] auto getFlows() const -> const graph_structs::SlotMap<common::FlowNodeID, graph_structs::Flow>&;
 
     [[nodiscard]] auto getNumberOfConfigs() const -> std::size_t;
 
+    /**
+     * @return the least common multiple of the periods of all flows, 1 if there are no flows
+     */
+    [[nodiscard]] auto getHyperCycle() const -> std::size_t;
+
+    /**
+     * @return the greatest common divisor of the periods of all flows, 0 if there are no flows
+     */
+    [[nodiscard]] auto getGcdPeriod() const -> std::size_t;
+
     [[nodiscard]] auto getNumberOfNetworkNodes() const -> std::size_t;
 
     [[nodiscard]] auto getNumberOfEgressQueues() const -> std::size_t;
 
     [[nodiscard]] auto getEgressQueuesOf(common::NetworkNodeID device) const -> std::span<const graph_structs::EgressQueue>;
 
+    /**
+     * @param device
+     * @return the ids of all egress queues whose destination is the device
+     */
+    [[nodiscard]] auto getIngressQueuesOf(common::NetworkNodeID device) const -> std::span<const common::NetworkQueueID>;
+
+    /**
+     * @param queue_id
+     * @return the network device the egress queue belongs to
+     */
+    [[nodiscard]] auto getSourceOf(common::NetworkQueueID queue_id) const -> common::NetworkNodeID;
+
     /**
      * const version of getEgressQueue
      * @param queue_id
@@ -45,6 +82,12 @@ public:
 
     [[nodiscard]] auto getEgressQueues() const -> std::span<const graph_structs::EgressQueue>;
 
+    /**
+     * @param queue_id
+     * @return the configs using the egress queue, unordered
+     */
+    [[nodiscard]] auto getUsersOf(common::NetworkQueueID queue_id) const -> std::span<const common::ConfigurationNodeID>;
+
     /**
      * Adds a network device node in the network layer csr with the according edges.
      *
@@ -58,6 +101,7 @@ public:
     /**
      * Adds a Flow struct to the graph.
      * This does not create any configurations, edges, etc.
+     * The period of the flow must not be changed afterwards, since it is accounted in the hyper cycle.
      * @param f
      */
     auto addFlow(graph_structs::Flow f) -> void;
@@ -68,28 +112,125 @@ public:
 
     /**
      * creates a Configuration struct and adds it to the graph.
-     * Attention: this method is not thread safe!
+     * The path is interned, i.e., configurations with identical hops share a single copy in the path pool and the
+     * path of the configuration is a view on it.
+     * Attention: this method is not thread safe and it may move the paths of all other configurations!
      * @param flow
-     * @param path
+     * @param path must not view a part of the path pool that is not a complete path
      * @return the newly assigned ConfigurationNodeID of the inserted config
      */
-    auto insertConfiguration(common::FlowNodeID flow, const std::vector<common::NetworkQueueID>& path) -> common::ConfigurationNodeID;
+    auto insertConfiguration(common::FlowNodeID flow, std::span<const common::NetworkQueueID> path) -> common::ConfigurationNodeID;
+
+    /**
+     * adds the config to the users of every egress queue of its path.
+     * Attention: this method is not thread safe!
+     * @param id
+     */
+    auto useEgressQueues(common::ConfigurationNodeID id) -> void;
 
     auto getConfiguration(common::ConfigurationNodeID id) -> graph_structs::Configuration&;
 
-    auto getConfigurations() const -> const robin_hood::unordered_map<common::ConfigurationNodeID, graph_structs::Configuration>&;
+    auto getConfiguration(common::ConfigurationNodeID id) const -> const graph_structs::Configuration&;
+
+    auto getConfigurations() const -> const graph_structs::SlotMap<common::ConfigurationNodeID, graph_structs::Configuration>&;
+
+    /**
+     * @return the number of distinct paths used by the configurations
+     */
+    [[nodiscard]] auto getNumberOfPaths() const -> std::size_t;
+
+    [[nodiscard]] auto getPath(common::PathID path_id) const -> std::span<const common::NetworkQueueID>;
 
 
 private:
     // Flow layer
-    robin_hood::unordered_map<common::FlowNodeID, graph_structs::Flow> flows_;
+    graph_structs::SlotMap<common::FlowNodeID, graph_structs::Flow> flows_;
+
+    // number of flows per period, the hyper cycle and gcd only have to be recomputed once a period is gone
+    robin_hood::unordered_map<std::size_t, std::size_t> period_histogram_;
+    std::size_t hyper_cycle_ = 1;
+    std::size_t gcd_period_ = 0;
+
+    auto removePeriod(std::size_t period) -> void;
 
     // Config layer
-    robin_hood::unordered_map<common::ConfigurationNodeID, graph_structs::Configuration> config_nodes_;
+    graph_structs::SlotMap<common::ConfigurationNodeID, graph_structs::Configuration> config_nodes_;
+
+    struct InternedPath
+    {
+        std::size_t offset;
+        std::size_t length;
+        // number of configs using the path, unused paths are kept until the next compaction
+        std::size_t references;
+    };
+
+    struct PathHash
+    {
+        auto operator()(std::span<const common::NetworkQueueID> path) const noexcept -> std::size_t;
+    };
+
+    struct PathEqual
+    {
+        auto operator()(std::span<const common::NetworkQueueID> lhs, std::span<const common::NetworkQueueID> rhs) const noexcept -> bool;
+    };
+
+    // hops of all interned paths, each path occupies a contiguous range of it
+    std::vector<common::NetworkQueueID> path_pool_;
+    std::size_t unused_path_hops_ = 0;
+    // indexed by PathID
+    std::vector<InternedPath> interned_paths_;
+    std::vector<common::PathID> free_path_ids_;
+    // keys view the path pool
+    robin_hood::unordered_map<std::span<const common::NetworkQueueID>, common::PathID, PathHash, PathEqual> path_ids_;
+
+    /**
+     * Returns the PathID of the given hops and increments its reference count. Unknown paths are copied into the pool.
+     * @param path
+     * @return
+     */
+    auto internPath(std::span<const common::NetworkQueueID> path) -> common::PathID;
+
+    /**
+     * Decrements the reference count of the path and drops it from the path table if it is no longer used.
+     * Its hops remain in the pool until the next compaction.
+     * @param path_id
+     */
+    auto releasePath(common::PathID path_id) -> void;
+
+    /**
+     * Copies all used paths densely into a new pool with at least the given capacity and relinks the configs.
+     * This drops the hops of released paths.
+     * @param capacity
+     */
+    auto rebuildPathPool(std::size_t capacity) -> void;
+
+    /**
+     * lets the configs and the path table view the current path pool
+     */
+    auto relinkPaths() -> void;
+
+    // users of each egress queue, indexed by NetworkQueueID. Removing a user swaps the last user into its place
+    std::vector<std::vector<common::ConfigurationNodeID>> queue_users_;
+
+    // position of a config within the users of each of its hops, indexed by offset + hop
+    std::vector<std::size_t> used_by_positions_;
+    std::size_t unused_used_by_positions_ = 0;
+    // offset into used_by_positions_ of each config that uses its egress queues
+    graph_structs::SlotMap<common::ConfigurationNodeID, std::size_t> used_by_position_offsets_;
+
+    /**
+     * removes the config from the users of every egress queue of its path by swapping the last user into its place
+     * @param id
+     */
+    auto unuseEgressQueues(common::ConfigurationNodeID id) -> void;
 
     // network layer
     std::vector<std::size_t> network_forward_offset_;
     std::vector<graph_structs::EgressQueue> network_forward_edges_;
+    // indexed by NetworkQueueID
+    std::vector<common::NetworkNodeID> network_queue_sources_;
+    // indexed by NetworkNodeID, devices might receive edges before they are inserted themselves
+    std::vector<std::vector<common::NetworkQueueID>> network_ingress_queues_;
 
     std::size_t config_id_counter_ = 0;
 };
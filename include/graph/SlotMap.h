@@ -0,0 +1,258 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace graph_structs {
+
+/**
+ * Associative container for the dense, externally assigned IDs of the graph (e.g. FlowNodeID, ConfigurationNodeID).
+ *
+ * The values are stored contiguously as (key, value) pairs and are iterated in storage order.
+ * A sparse slot vector indexed by the raw key value maps each key to its dense position, giving O(1) lookups
+ * without hashing. Removal swaps the last element into the gap, i.e., it invalidates iterators and references
+ * to the moved element, but never changes a key.
+ *
+ * Every slot carries a generation that is drawn from a counter of the map whenever its key is inserted or erased.
+ * A Handle remembers the generation it was created with and no longer resolves once its key was removed, even if
+ * the same key is inserted again later.
+ *
+ * The sparse vector only spans the keys between the smallest and the largest contained key. The IDs are assigned
+ * in increasing order and old ones are erased, thus the empty slots in front are dropped once they make up half of the
+ * vector and the vector is re-based to the smallest contained key.
+ */
+template<class Key, class Value>
+class SlotMap
+{
+public:
+    using value_type = std::pair<Key, Value>;
+    using iterator = typename std::vector<value_type>::iterator;
+    using const_iterator = typename std::vector<value_type>::const_iterator;
+
+    struct Handle
+    {
+        Key key;
+        std::uint32_t generation;
+    };
+
+    [[nodiscard]] auto size() const noexcept -> std::size_t
+    {
+        return dense_.size();
+    }
+
+    [[nodiscard]] auto empty() const noexcept -> bool
+    {
+        return dense_.empty();
+    }
+
+    [[nodiscard]] auto begin() noexcept -> iterator
+    {
+        return dense_.begin();
+    }
+
+    [[nodiscard]] auto end() noexcept -> iterator
+    {
+        return dense_.end();
+    }
+
+    [[nodiscard]] auto begin() const noexcept -> const_iterator
+    {
+        return dense_.cbegin();
+    }
+
+    [[nodiscard]] auto end() const noexcept -> const_iterator
+    {
+        return dense_.cend();
+    }
+
+    [[nodiscard]] auto cbegin() const noexcept -> const_iterator
+    {
+        return dense_.cbegin();
+    }
+
+    [[nodiscard]] auto cend() const noexcept -> const_iterator
+    {
+        return dense_.cend();
+    }
+
+    [[nodiscard]] auto contains(const Key key) const noexcept -> bool
+    {
+        return key.get() >= base_ and key.get() - base_ < slots_.size() and slotOf(key).index != EMPTY;
+    }
+
+    /**
+     * @return the number of slots, i.e., the range of keys the sparse vector currently spans
+     */
+    [[nodiscard]] auto slot_count() const noexcept -> std::size_t
+    {
+        return slots_.size();
+    }
+
+    /**
+     * @param key
+     * @return the value of key
+     * @throws std::out_of_range if key is not contained
+     */
+    [[nodiscard]] auto at(const Key key) -> Value&
+    {
+        return dense_[checkedIndex(key)].second;
+    }
+
+    [[nodiscard]] auto at(const Key key) const -> const Value&
+    {
+        return dense_[checkedIndex(key)].second;
+    }
+
+    /**
+     * Inserts value under key or overwrites the existing value of key.
+     * Overwriting keeps the generation, i.e., existing handles stay valid.
+     * @param key
+     * @param value
+     * @return the stored value
+     */
+    auto insert_or_assign(const Key key, Value value) -> Value&
+    {
+        if(contains(key)) {
+            auto& stored = dense_[slotOf(key).index].second;
+            stored = std::move(value);
+            return stored;
+        }
+
+        if(slots_.empty()) {
+            base_ = key.get();
+        } else if(key.get() < base_) {
+            const auto additional_slots = base_ - key.get();
+            slots_.insert(slots_.begin(), additional_slots, Slot{});
+            leading_empty_slots_ += additional_slots;
+            base_ = key.get();
+        }
+        if(key.get() - base_ >= slots_.size()) {
+            slots_.resize(key.get() - base_ + 1);
+        }
+        leading_empty_slots_ = std::min(leading_empty_slots_, key.get() - base_);
+
+        auto& slot = slotOf(key);
+        slot.index = static_cast<std::uint32_t>(dense_.size());
+        slot.generation = ++generation_;
+        return dense_.emplace_back(key, std::move(value)).second;
+    }
+
+    /**
+     * @param key
+     * @return true if key was contained
+     */
+    auto erase(const Key key) -> bool
+    {
+        if(not contains(key)) {
+            return false;
+        }
+
+        auto& slot = slotOf(key);
+        const auto index = slot.index;
+        if(index + 1 != dense_.size()) {
+            dense_[index] = std::move(dense_.back());
+            slotOf(dense_[index].first).index = index;
+        }
+        dense_.pop_back();
+
+        slot.index = EMPTY;
+        slot.generation = ++generation_;
+        shrinkSlots();
+        return true;
+    }
+
+    /**
+     * @param key must be contained
+     * @return a handle that resolves as long as key is not erased
+     */
+    [[nodiscard]] auto handle(const Key key) const -> Handle
+    {
+        if(not contains(key)) {
+            throw std::out_of_range("SlotMap: key not found");
+        }
+        return Handle{key, slotOf(key).generation};
+    }
+
+    /**
+     * @param handle
+     * @return the value of the handle or nullptr if its key was erased in the meantime
+     */
+    [[nodiscard]] auto find(const Handle handle) -> Value*
+    {
+        if(not contains(handle.key) or slotOf(handle.key).generation != handle.generation) {
+            return nullptr;
+        }
+        return &dense_[slotOf(handle.key).index].second;
+    }
+
+    [[nodiscard]] auto find(const Handle handle) const -> const Value*
+    {
+        return const_cast<SlotMap*>(this)->find(handle);
+    }
+
+private:
+    static constexpr auto EMPTY = std::numeric_limits<std::uint32_t>::max();
+
+    struct Slot
+    {
+        std::uint32_t index = EMPTY;
+        std::uint32_t generation = 0;
+    };
+
+    [[nodiscard]] auto slotOf(const Key key) -> Slot&
+    {
+        return slots_[key.get() - base_];
+    }
+
+    [[nodiscard]] auto slotOf(const Key key) const -> const Slot&
+    {
+        return slots_[key.get() - base_];
+    }
+
+    [[nodiscard]] auto checkedIndex(const Key key) const -> std::uint32_t
+    {
+        if(not contains(key)) {
+            throw std::out_of_range("SlotMap: key not found");
+        }
+        return slotOf(key).index;
+    }
+
+    /**
+     * drops the empty slots behind the largest key and, once they make up half of the slots, the empty slots in front
+     * of the smallest key. Each slot is skipped at most once before it is dropped, thus erase stays amortized O(1).
+     * Dropped slots lose their generation, which is safe because generations are never reused.
+     */
+    auto shrinkSlots() -> void
+    {
+        while(not slots_.empty() and slots_.back().index == EMPTY) {
+            slots_.pop_back();
+        }
+        if(slots_.empty()) {
+            leading_empty_slots_ = 0;
+            return;
+        }
+        while(slots_[leading_empty_slots_].index == EMPTY) {
+            ++leading_empty_slots_;
+        }
+        if(2 * leading_empty_slots_ >= slots_.size()) {
+            slots_.erase(slots_.begin(), slots_.begin() + static_cast<std::ptrdiff_t>(leading_empty_slots_));
+            base_ += leading_empty_slots_;
+            leading_empty_slots_ = 0;
+        }
+    }
+
+    std::vector<Slot> slots_;
+    std::vector<value_type> dense_;
+    // key of slots_[0]
+    std::size_t base_ = 0;
+    // the first slots that are empty, all of them are in front of the smallest key
+    std::size_t leading_empty_slots_ = 0;
+    std::uint32_t generation_ = 0;
+};
+
+} // namespace graph_structs
@@ -3,6 +3,9 @@
 #include "Typedefs.h"
 #include "graph/GraphStructs.h"
 #include "graph/MultiLayeredGraph.h"
+#include "routing/RouteGenerator.h"
+#include "solver/UtilizationList.h"
+#include <memory>
 
 namespace routing {
 
@@ -13,6 +16,7 @@ public:
 
     /**
      * calculates routes between source and destination node.
+     * Might be called concurrently for the same network, thus implementations must not modify shared state unguarded.
      * @param source
      * @param destination
      * @param network
@@ -24,6 +28,25 @@ public:
                                           std::size_t number_of_candidates)
         -> std::vector<std::vector<common::NetworkQueueID>> = 0;
 
+    /**
+     * creates a generator yielding the same routes as findRoutes, one at a time.
+     * By default, the routes are computed again for every call of next(). Navigators that can resume their search override it.
+     * The generator refers to this navigator, which has to outlive it.
+     * @param source
+     * @param destination
+     * @return
+     */
+    [[nodiscard]] virtual auto createRouteGenerator(common::NetworkNodeID source, common::NetworkNodeID destination)
+        -> std::unique_ptr<RouteGenerator>;
+
+    /**
+     * informs the navigator about the slots reserved by the active flows. Called before the routes of a time step are computed.
+     * Navigators routing independent of the load ignore it.
+     * @param network
+     * @param utilization
+     */
+    virtual auto updateUtilization(const MultiLayeredGraph& /*network*/, const common::NetworkUtilizationList& /*utilization*/) -> void {}
+
     virtual ~AbstractNavigation() = default;
 };
 } // namespace routing
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "AbstractNavigation.h"
+#include <atomic>
+#include <memory>
+#include <shared_mutex>
+#include <util/robin_hood.h>
+
+namespace routing {
+
+/**
+ * Decorator that remembers the routes of another navigator per (source, destination, number of candidates).
+ * The routes only depend on the topology, which never changes during a scenario. Thus, flows between an already known
+ * pair of devices cost a lookup instead of a route computation.
+ */
+class CachedNavigation final : public AbstractNavigation
+{
+
+public:
+    explicit CachedNavigation(std::shared_ptr<AbstractNavigation> navigator);
+
+    /**
+     * @return the name of the decorated navigator, since the routes are the same
+     */
+    auto name() -> std::string override;
+
+    /**
+     * returns the cached routes between source and destination or asks the decorated navigator on a cache miss.
+     * Concurrent calls are safe, the decorated navigator is asked without holding the lock.
+     * @param source
+     * @param destination
+     * @param network must have the same topology on every call
+     * @param number_of_candidates
+     * @return
+     */
+    [[nodiscard]] auto findRoutes(common::NetworkNodeID source, common::NetworkNodeID destination,
+                                  const MultiLayeredGraph &network,
+                                  std::size_t number_of_candidates)
+        -> std::vector<std::vector<common::NetworkQueueID>> override;
+
+    /**
+     * generators are not cached, the decorated navigator creates them
+     * @param source
+     * @param destination
+     * @return
+     */
+    [[nodiscard]] auto createRouteGenerator(common::NetworkNodeID source, common::NetworkNodeID destination)
+        -> std::unique_ptr<RouteGenerator> override;
+
+    [[nodiscard]] auto getNumberOfCacheHits() const -> std::size_t;
+
+    [[nodiscard]] auto getNumberOfCacheMisses() const -> std::size_t;
+
+private:
+    struct RouteKey
+    {
+        common::NetworkNodeID source;
+        common::NetworkNodeID destination;
+        std::size_t number_of_candidates;
+
+        bool operator==(const RouteKey &other) const = default;
+    };
+
+    struct RouteKeyHash
+    {
+        auto operator()(const RouteKey &key) const noexcept -> std::size_t;
+    };
+
+    std::shared_ptr<AbstractNavigation> navigator_;
+    robin_hood::unordered_map<RouteKey, std::vector<std::vector<common::NetworkQueueID>>, RouteKeyHash> routes_;
+    mutable std::shared_mutex routes_mutex_;
+    std::atomic<std::size_t> cache_hits_ = 0;
+    std::atomic<std::size_t> cache_misses_ = 0;
+};
+} // namespace routing
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "AbstractNavigation.h"
+#include <cstdint>
+
+namespace routing {
+
+/**
+ * Dijkstra overlap routing on a loaded network: the initial weight of each egress queue grows with the share of the
+ * hyper cycle that is reserved on it. Thus, candidate paths avoid the links that are congested by the active flows.
+ */
+class CongestionAwareNavigation final : public AbstractNavigation
+{
+
+public:
+    /**
+     * @param congestion_weight additional weight of a fully reserved egress queue, an idle queue weighs 1
+     */
+    explicit CongestionAwareNavigation(std::size_t congestion_weight = 10);
+
+    auto name() -> std::string override;
+
+    /**
+     * calculates routes between source and destination node.
+     * Like DijkstraOverlap, the weights of all edges used by a path are increased to encourage using different edges next time.
+     * @param source
+     * @param destination
+     * @param network
+     * @param number_of_candidates number of candidates to be calculated. If there are not as many distinct paths, less paths will be returned.
+     * @return
+     */
+    [[nodiscard]] auto findRoutes(common::NetworkNodeID source, common::NetworkNodeID destination,
+                                  const MultiLayeredGraph &network,
+                                  std::size_t number_of_candidates)
+        -> std::vector<std::vector<common::NetworkQueueID>> override;
+
+    /**
+     * derives the weights of the egress queues from their reserved time.
+     * Attention: this method is not thread safe and must not run concurrently to findRoutes!
+     * @param network
+     * @param utilization
+     */
+    auto updateUtilization(const MultiLayeredGraph &network, const common::NetworkUtilizationList &utilization) -> void override;
+
+private:
+    const int DUPLICATE_PATH_LIMIT = 10;
+    std::int64_t congestion_weight_;
+    // queues with reserved time and their weight
+    std::vector<std::pair<common::NetworkQueueID, std::int64_t>> congested_queues_;
+};
+} // namespace routing
@@ -24,6 +24,15 @@ public:
                                   std::size_t number_of_candidates)
         -> std::vector<std::vector<common::NetworkQueueID>> override;
 
+    /**
+     * the generator keeps the increased edge weights, thus the next route costs a single Dijkstra (plus duplicates)
+     * @param source
+     * @param destination
+     * @return
+     */
+    [[nodiscard]] auto createRouteGenerator(common::NetworkNodeID source, common::NetworkNodeID destination)
+        -> std::unique_ptr<RouteGenerator> override;
+
 private:
     const int DUPLICATE_PATH_LIMIT = 10;
 };
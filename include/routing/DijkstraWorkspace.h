@@ -0,0 +1,173 @@
+#pragma once
+
+#include <Typedefs.h>
+#include <cstdint>
+#include <graph/MultiLayeredGraph.h>
+#include <optional>
+#include <vector>
+
+namespace routing {
+
+/**
+ * Reusable state for repeated Dijkstra runs on the same network.
+ *
+ * All arrays are indexed densely by node or queue id and are only allocated when the network grows.
+ * Instead of clearing them, every search and every weight reset starts a new epoch. An entry is only valid if its
+ * stamp equals the current epoch, thus a search costs time proportional to the nodes it touches, not to the network size.
+ *
+ * Edge weights default to 1 and can be increased or removed per egress queue until the next resetWeights().
+ * Searches run bidirectionally, i.e., from the source along the egress queues and from the destination along the
+ * ingress queues, until both meet. As long as all weights are small integers, both directions use a bucket queue
+ * (Dial's algorithm) instead of a binary heap.
+ */
+class DijkstraWorkspace
+{
+public:
+    /**
+     * @param queue_id
+     * @param weight
+     */
+    auto setWeight(common::NetworkQueueID queue_id, std::int64_t weight) -> void;
+
+    [[nodiscard]] auto getWeight(common::NetworkQueueID queue_id) const -> std::int64_t;
+
+    /**
+     * the queue is ignored by all searches until the next resetWeights()
+     * @param queue_id
+     */
+    auto removeEdge(common::NetworkQueueID queue_id) -> void;
+
+    [[nodiscard]] auto isRemoved(common::NetworkQueueID queue_id) const -> bool;
+
+    /**
+     * @param queue_id
+     * @return true if the weight of the queue was set or the queue was removed since the last resetWeights()
+     */
+    [[nodiscard]] auto hasWeight(common::NetworkQueueID queue_id) const -> bool;
+
+    /**
+     * sets all weights back to 1 in O(1)
+     */
+    auto resetWeights() -> void;
+
+    /**
+     * computes a shortest path with the current weights, removed edges are skipped.
+     * @param source
+     * @param destination
+     * @param network
+     * @return the egress queues of the path, empty if source equals destination
+     * @throws std::runtime_error if destination is not reachable
+     */
+    [[nodiscard]] auto shortestPath(common::NetworkNodeID source, common::NetworkNodeID destination,
+                                    const MultiLayeredGraph &network)
+        -> std::vector<common::NetworkQueueID>;
+
+    /**
+     * same as shortestPath, but without throwing
+     * @param source
+     * @param destination
+     * @param network
+     * @return the egress queues of the path or std::nullopt if destination is not reachable
+     */
+    [[nodiscard]] auto findShortestPath(common::NetworkNodeID source, common::NetworkNodeID destination,
+                                        const MultiLayeredGraph &network)
+        -> std::optional<std::vector<common::NetworkQueueID>>;
+
+private:
+    using NodeDistancePair = std::pair<common::NetworkNodeID, std::int64_t>;
+
+    static constexpr std::int64_t UNREACHED = INT64_MAX - 1000000;
+    static constexpr std::int64_t REMOVED = -1;
+    // up to this maximum edge weight the bucket queue is used, above it the binary heap
+    static constexpr std::int64_t MAX_BUCKET_WEIGHT = 64;
+
+    /**
+     * search state of one direction per node, valid if the stamp equals search_epoch_
+     */
+    struct SearchSide
+    {
+        std::vector<std::int64_t> distances;
+        // forward: the queue the node was reached by, backward: the queue leaving the node towards the destination
+        std::vector<common::NetworkQueueID> links;
+        std::vector<std::uint32_t> distance_stamps;
+        std::vector<std::uint32_t> visited_stamps;
+    };
+
+    /**
+     * binary heap of tentative distances, may hold outdated duplicates
+     */
+    class HeapFrontier
+    {
+    public:
+        auto clear(std::int64_t max_weight) -> void;
+        auto push(common::NetworkNodeID node, std::int64_t distance) -> void;
+        [[nodiscard]] auto empty() const -> bool;
+        /**
+         * @return a lower bound of all queued distances
+         */
+        [[nodiscard]] auto minDistance() -> std::int64_t;
+        auto pop() -> NodeDistancePair;
+
+    private:
+        std::vector<NodeDistancePair> heap_;
+    };
+
+    /**
+     * circular array of buckets (Dial's algorithm), may hold outdated duplicates.
+     * Requires every pushed distance to be at most max_weight larger than the last popped one.
+     */
+    class BucketFrontier
+    {
+    public:
+        auto clear(std::int64_t max_weight) -> void;
+        auto push(common::NetworkNodeID node, std::int64_t distance) -> void;
+        [[nodiscard]] auto empty() const -> bool;
+        /**
+         * @return a lower bound of all queued distances
+         */
+        [[nodiscard]] auto minDistance() -> std::int64_t;
+        auto pop() -> NodeDistancePair;
+
+    private:
+        // bucket i holds the nodes with distance d where d % number_of_buckets_ == i
+        std::vector<std::vector<common::NetworkNodeID>> buckets_;
+        std::size_t number_of_buckets_ = 1;
+        std::int64_t current_distance_ = 0;
+        std::size_t size_ = 0;
+    };
+
+    /**
+     * grows the arrays to the size of the network and starts a new search epoch
+     * @param network
+     */
+    auto prepare(const MultiLayeredGraph &network) -> void;
+
+    [[nodiscard]] auto distance(const SearchSide &side, common::NetworkNodeID node) const -> std::int64_t;
+
+    /**
+     * runs both directions until the shortest path is known
+     * @return the node where the shortest path's halves meet or std::nullopt if destination is not reachable
+     */
+    template<class Frontier>
+    auto bidirectionalSearch(common::NetworkNodeID source, common::NetworkNodeID destination,
+                             const MultiLayeredGraph &network,
+                             Frontier &forward_frontier, Frontier &backward_frontier)
+        -> std::optional<common::NetworkNodeID>;
+
+    // weights, valid if the stamp equals weight_epoch_
+    std::vector<std::int64_t> weights_;
+    std::vector<std::uint32_t> weight_stamps_;
+    std::uint32_t weight_epoch_ = 1;
+    // largest weight set since the last reset, removed edges don't count
+    std::int64_t max_weight_ = 1;
+
+    SearchSide forward_;
+    SearchSide backward_;
+    std::uint32_t search_epoch_ = 0;
+
+    HeapFrontier forward_heap_;
+    HeapFrontier backward_heap_;
+    BucketFrontier forward_buckets_;
+    BucketFrontier backward_buckets_;
+};
+} // namespace routing
@@ -0,0 +1,142 @@
+#pragma once
+
+#include "AbstractNavigation.h"
+#include <array>
+#include <cstdint>
+
+namespace routing {
+
+/**
+ * Computes the candidates as one min-cost flow of number_of_candidates units from source to destination
+ * (successive shortest paths with a bidirectional Dijkstra on reduced costs, as in Suurballe's and Bhandari's algorithms).
+ *
+ * The cost of routing a further unit over an egress queue grows with the units already routed over it. A shared queue costs
+ * more than any detour, thus the candidates are edge-disjoint where the network allows it and otherwise overlap as little
+ * as possible, e.g., on the single link of an end device.
+ */
+class EdgeDisjointNavigation final : public AbstractNavigation
+{
+
+public:
+    auto name() -> std::string override;
+
+    /**
+     * calculates edge-disjoint or minimally overlapping routes between source and destination node.
+     * @param source
+     * @param destination
+     * @param network
+     * @param number_of_candidates number of candidates to be calculated. If there are not as many distinct paths, less paths will be returned.
+     * @return the routes ordered by their length
+     * @throws std::runtime_error if destination is not reachable
+     */
+    [[nodiscard]] auto findRoutes(common::NetworkNodeID source, common::NetworkNodeID destination,
+                                  const MultiLayeredGraph &network,
+                                  std::size_t number_of_candidates)
+        -> std::vector<std::vector<common::NetworkQueueID>> override;
+
+private:
+    const int DUPLICATE_PATH_LIMIT = 10;
+
+    struct ResidualLink
+    {
+        common::NetworkQueueID queue;
+        // false if the link cancels a unit routed over the queue
+        bool forward;
+    };
+
+    /**
+     * Reusable state of the min-cost flow, like DijkstraWorkspace the arrays are only allocated when the network grows.
+     * Entries are valid if their stamp equals the current epoch, thus a flow and a search cost time proportional to the
+     * nodes they touch, not to the network size.
+     */
+    class Workspace
+    {
+    public:
+        /**
+         * removes all units and potentials
+         * @param network
+         */
+        auto resetFlow(const MultiLayeredGraph &network) -> void;
+
+        [[nodiscard]] auto getUnits(common::NetworkQueueID queue_id) const -> std::int64_t;
+
+        /**
+         * routes one more unit along the cheapest residual path
+         * @param source
+         * @param destination
+         * @param network
+         * @param overlap_penalty
+         * @throws std::runtime_error if destination is not reachable
+         */
+        auto routeUnit(common::NetworkNodeID source, common::NetworkNodeID destination,
+                       const MultiLayeredGraph &network,
+                       std::int64_t overlap_penalty) -> void;
+
+    private:
+        using NodeDistancePair = std::pair<std::int64_t, common::UnderlyingID>;
+
+        static constexpr std::size_t FORWARD = 0;
+        static constexpr std::size_t BACKWARD = 1;
+
+        /**
+         * state of one direction of the search, valid if the stamp equals search_epoch_
+         */
+        struct SearchSide
+        {
+            std::vector<std::int64_t> distances;
+            // forward: the link to the node, backward: the link from the node towards the destination
+            std::vector<ResidualLink> links;
+            std::vector<std::uint32_t> distance_stamps;
+            std::vector<std::uint32_t> settled_stamps;
+            std::vector<common::UnderlyingID> settled_nodes;
+            std::vector<NodeDistancePair> heap;
+        };
+
+        [[nodiscard]] auto getPotential(common::UnderlyingID node) const -> std::int64_t;
+
+        auto addUnits(common::NetworkQueueID queue_id, std::int64_t units) -> void;
+
+        /**
+         * Bidirectional Dijkstra on the residual network with the reduced costs, which are non-negative due to the potentials.
+         * Afterwards, the potentials are updated, such that the reduced costs stay non-negative once the unit is routed.
+         * @return true if destination was reached
+         */
+        [[nodiscard]] auto search(common::NetworkNodeID source, common::NetworkNodeID destination,
+                                  const MultiLayeredGraph &network,
+                                  std::int64_t overlap_penalty) -> bool;
+
+        // valid if the stamp equals flow_epoch_
+        std::vector<std::int64_t> units_;
+        std::vector<std::uint32_t> unit_stamps_;
+        std::vector<std::int64_t> potentials_;
+        std::vector<std::uint32_t> potential_stamps_;
+        std::uint32_t flow_epoch_ = 0;
+
+        std::array<SearchSide, 2> sides_;
+        std::uint32_t search_epoch_ = 0;
+        // node of the last search where the shortest path is joined from both sides
+        common::UnderlyingID meeting_node_ = 0;
+    };
+
+    /**
+     * cost of the next unit routed over a queue, convex in the units already routed over it
+     * @param units
+     * @param overlap_penalty
+     * @return
+     */
+    [[nodiscard]] static auto unitCost(std::int64_t units, std::int64_t overlap_penalty) -> std::int64_t;
+
+    /**
+     * splits the flow into paths from source to destination
+     * @param source
+     * @param destination
+     * @param network
+     * @param workspace holding the flow
+     * @return the distinct paths
+     */
+    [[nodiscard]] static auto decomposeFlow(common::NetworkNodeID source, common::NetworkNodeID destination,
+                                            const MultiLayeredGraph &network,
+                                            const Workspace &workspace)
+        -> std::vector<std::vector<common::NetworkQueueID>>;
+};
+} // namespace routing
@@ -1,7 +1,8 @@
 #pragma once
 
-#include "RoutingUtil.h"
+#include "DijkstraWorkspace.h"
 #include <routing/AbstractNavigation.h>
+#include <util/robin_hood.h>
 
 namespace routing {
 
@@ -15,12 +16,55 @@ public:
                     std::size_t number_of_candidates)
         -> std::vector<std::vector<common::NetworkQueueID>> override;
 
+    /**
+     * the generator keeps the found paths, the candidate heap and the prefix tree of Yen's algorithm between the calls.
+     * @param source
+     * @param destination
+     * @return
+     */
+    [[nodiscard]] auto createRouteGenerator(common::NetworkNodeID source, common::NetworkNodeID destination)
+        -> std::unique_ptr<RouteGenerator> override;
+
 private:
-    auto effectivelyRemoveNode(common::NetworkNodeID node,
-                               const MultiLayeredGraph& graph,
-                               routing::WeightMap& weightMap) const -> void;
+    // Yen's algorithm, each call of next() computes the next shortest path
+    class Generator;
+
+    struct Candidate
+    {
+        std::vector<common::NetworkQueueID> path;
+        // index of the spur node the path was found at
+        std::size_t deviation_index;
+        // breaks ties between candidates of equal length deterministically
+        std::size_t sequence_number;
+    };
+
+    struct PrefixTreeNode
+    {
+        // next hop and index of the child node
+        std::vector<std::pair<common::NetworkQueueID, std::size_t>> children;
+    };
+
+    struct PathHash
+    {
+        auto operator()(const std::vector<common::NetworkQueueID>& path) const noexcept -> std::size_t;
+    };
+
+    static auto effectivelyRemoveNode(common::NetworkNodeID node,
+                                      const MultiLayeredGraph& graph,
+                                      DijkstraWorkspace& workspace) -> void;
+
+    static auto insertIntoPrefixTree(std::vector<PrefixTreeNode>& prefix_tree,
+                                     const std::vector<common::NetworkQueueID>& path) -> void;
 
-    const std::size_t LARGE_NUMBER = 1000000;
+    /**
+     * @param prefix_tree
+     * @param tree_node
+     * @param hop
+     * @return the child of tree_node reached by hop or 0 if there is none
+     */
+    [[nodiscard]] static auto findChildInPrefixTree(const std::vector<PrefixTreeNode>& prefix_tree,
+                                                    std::size_t tree_node,
+                                                    common::NetworkQueueID hop) -> std::size_t;
 };
 
 
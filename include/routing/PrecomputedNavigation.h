@@ -0,0 +1,147 @@
+#pragma once
+
+#include "AbstractNavigation.h"
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+
+namespace routing {
+
+/**
+ * Decorator that answers from a table holding the routes between all pairs of end devices.
+ * The table is either computed at startup (in parallel) or memory mapped from a file written by an earlier run.
+ * Flows between other devices or with a different number of candidates are routed by the decorated navigator.
+ *
+ * File layout (native byte order): a header of HEADER_FIELDS 64 bit values, the end device ids, padded to 8 bytes,
+ * the 64 bit offsets of the routes per device pair, the 64 bit offsets of the hops per route and the hops.
+ * The header identifies the network, the decorated navigator and the number of candidates the table was computed for.
+ */
+class PrecomputedNavigation final : public AbstractNavigation
+{
+
+public:
+    PrecomputedNavigation(const PrecomputedNavigation &) = delete;
+    PrecomputedNavigation(PrecomputedNavigation &&) noexcept = default;
+    auto operator=(const PrecomputedNavigation &) -> PrecomputedNavigation & = delete;
+    auto operator=(PrecomputedNavigation &&) noexcept -> PrecomputedNavigation & = default;
+    ~PrecomputedNavigation() override = default;
+
+    /**
+     * computes the routes between all pairs of end devices with navigator.
+     * Pairs that are not connected are stored without routes and are routed by navigator on request.
+     * @param navigator must support concurrent calls, answers all requests that are not in the table
+     * @param network
+     * @param number_of_candidates
+     * @param number_of_threads threads computing the routes, the result does not depend on it
+     * @return
+     */
+    [[nodiscard]] static auto precompute(std::shared_ptr<AbstractNavigation> navigator,
+                                         const MultiLayeredGraph &network,
+                                         std::size_t number_of_candidates,
+                                         std::size_t number_of_threads)
+        -> PrecomputedNavigation;
+
+    /**
+     * memory maps a table written by save()
+     * @param path
+     * @param navigator answers all requests that are not in the table
+     * @param network
+     * @param number_of_candidates
+     * @return std::nullopt if the file can not be read, is corrupt or was computed for a different network, navigator or
+     *         number of candidates
+     */
+    [[nodiscard]] static auto load(const std::string &path,
+                                   std::shared_ptr<AbstractNavigation> navigator,
+                                   const MultiLayeredGraph &network,
+                                   std::size_t number_of_candidates)
+        -> std::optional<PrecomputedNavigation>;
+
+    /**
+     * @param path
+     * @return true if the table was written successfully
+     */
+    [[nodiscard]] auto save(const std::string &path) const -> bool;
+
+    /**
+     * @return the name of the decorated navigator, since the routes are the same
+     */
+    auto name() -> std::string override;
+
+    [[nodiscard]] auto findRoutes(common::NetworkNodeID source, common::NetworkNodeID destination,
+                                  const MultiLayeredGraph &network,
+                                  std::size_t number_of_candidates)
+        -> std::vector<std::vector<common::NetworkQueueID>> override;
+
+    /**
+     * generators are not cached, the decorated navigator creates them
+     * @param source
+     * @param destination
+     * @return
+     */
+    [[nodiscard]] auto createRouteGenerator(common::NetworkNodeID source, common::NetworkNodeID destination)
+        -> std::unique_ptr<RouteGenerator> override;
+
+    [[nodiscard]] auto getNumberOfEndDevices() const -> std::size_t;
+
+private:
+    static constexpr std::uint64_t MAGIC = 0x32545246534641; // "AFSFRT2"
+    static constexpr std::size_t HEADER_FIELDS = 10;
+    static constexpr std::size_t NO_END_DEVICE = std::numeric_limits<std::size_t>::max();
+
+    explicit PrecomputedNavigation(std::shared_ptr<AbstractNavigation> navigator);
+
+    /**
+     * identifies the topology, so that tables of other networks are rejected
+     * @param network
+     * @return
+     */
+    [[nodiscard]] static auto hashTopology(const MultiLayeredGraph &network) -> std::uint64_t;
+
+    /**
+     * identifies the routing algorithm, so that tables of other navigators are rejected
+     * @param navigator_name
+     * @return
+     */
+    [[nodiscard]] static auto hashName(const std::string &navigator_name) -> std::uint64_t;
+
+    /**
+     * checks that the offsets of a loaded table increase and stay within the routes and hops
+     * and that all hops are egress queues of the network
+     * @param number_of_queues
+     * @return
+     */
+    [[nodiscard]] auto hasValidOffsets(std::size_t number_of_queues) const -> bool;
+
+    /**
+     * fills device_index_ from devices_
+     * @param network
+     */
+    auto indexEndDevices(const MultiLayeredGraph &network) -> void;
+
+    std::shared_ptr<AbstractNavigation> navigator_;
+    std::size_t number_of_queues_ = 0;
+    std::uint64_t topology_hash_ = 0;
+    std::uint64_t navigator_hash_ = 0;
+    std::size_t number_of_candidates_ = 0;
+
+    // the table, either viewing the owned vectors or the memory mapped file
+    std::span<const common::UnderlyingID> devices_;
+    // routes of the pair (i, j) of end devices: [pair_offsets_[i * devices + j], pair_offsets_[i * devices + j + 1])
+    std::span<const std::uint64_t> pair_offsets_;
+    // hops of route r: [route_offsets_[r], route_offsets_[r + 1])
+    std::span<const std::uint64_t> route_offsets_;
+    std::span<const common::UnderlyingID> hops_;
+
+    std::vector<common::UnderlyingID> owned_devices_;
+    std::vector<std::uint64_t> owned_pair_offsets_;
+    std::vector<std::uint64_t> owned_route_offsets_;
+    std::vector<common::UnderlyingID> owned_hops_;
+    std::shared_ptr<const std::byte> mapping_;
+
+    // index of each network node in devices_ or NO_END_DEVICE
+    std::vector<std::size_t> device_index_;
+};
+} // namespace routing
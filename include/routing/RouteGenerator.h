@@ -0,0 +1,28 @@
+#pragma once
+
+#include "Typedefs.h"
+#include "graph/MultiLayeredGraph.h"
+#include <optional>
+#include <vector>
+
+namespace routing {
+
+/**
+ * Resumable route computation between one pair of nodes.
+ * Each call of next() continues where the previous one stopped, thus the candidate paths of a flow can be
+ * computed one at a time, only when they are needed.
+ */
+class RouteGenerator
+{
+public:
+    /**
+     * computes the next route, different from all routes returned before.
+     * Generators of different flows might be used concurrently, a single generator must not.
+     * @param network must have the same topology on every call
+     * @return the egress queues of the route or std::nullopt if there are no further routes
+     */
+    [[nodiscard]] virtual auto next(const MultiLayeredGraph& network) -> std::optional<std::vector<common::NetworkQueueID>> = 0;
+
+    virtual ~RouteGenerator() = default;
+};
+} // namespace routing
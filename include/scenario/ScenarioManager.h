@@ -5,6 +5,7 @@
 #include <graph/MultiLayeredGraph.h>
 #include <routing/AbstractNavigation.h>
 #include <scenario/TimeStep.h>
+#include <functional>
 
 class ScenarioManager
 {
@@ -18,21 +19,84 @@ public:
 private:
     /**
      * removes flows from graph that are removed in time_step and adds flows accordingly.
+     * The routes of the added flows are computed in parallel, the configurations are inserted in the order of the time step.
      * @param graph
      * @param time_step
      * @param navigator
      * @param no_candidate_paths
+     * @param number_of_threads threads computing the routes, the result does not depend on it
+     * @param lazy_candidate_paths if set, only the first route of each added flow is inserted and the further ones are
+     *                             generated on demand by generateFurtherCandidates
      * @return pair, first element: reqF flow set, second element: time required for the flow handling
      */
     auto handleFlowChanges(MultiLayeredGraph& graph,
                            io::TimeStep& time_step,
                            const std::shared_ptr<routing::AbstractNavigation> &navigator,
-                           std::size_t no_candidate_paths)
+                           std::size_t no_candidate_paths,
+                           std::size_t number_of_threads,
+                           bool lazy_candidate_paths)
         -> std::pair<robin_hood::unordered_set<common::FlowNodeID>, double>;
 
+    /**
+     * computes the routes of all given flows, the graph is not modified.
+     * @param graph
+     * @param flows
+     * @param navigator
+     * @param no_candidate_paths
+     * @param number_of_threads
+     * @return the routes per flow, in the order of flows
+     */
+    static auto findRoutesOf(const MultiLayeredGraph& graph,
+                             const std::vector<graph_structs::Flow>& flows,
+                             routing::AbstractNavigation& navigator,
+                             std::size_t no_candidate_paths,
+                             std::size_t number_of_threads)
+        -> std::vector<std::vector<std::vector<common::NetworkQueueID>>>;
+
+    /**
+     * creates a route generator per flow and computes the first route of each, the graph is not modified.
+     * The generators are kept until the end of the time step.
+     * @param graph
+     * @param flows
+     * @param navigator
+     * @param number_of_threads
+     * @return the first route per flow (none if there is no route), in the order of flows
+     */
+    auto startRouteGenerators(const MultiLayeredGraph& graph,
+                              const std::vector<graph_structs::Flow>& flows,
+                              routing::AbstractNavigation& navigator,
+                              std::size_t number_of_threads)
+        -> std::vector<std::vector<std::vector<common::NetworkQueueID>>>;
+
+    /**
+     * inserts the next candidate path as configuration for every given flow with less than no_candidate_paths configurations.
+     * The routes are computed in parallel, the configurations are inserted in the order of the flow ids.
+     * Attention: this method modifies the graph, it must not run concurrently to a scheduler!
+     * @param graph
+     * @param flows
+     * @param no_candidate_paths maximum number of configurations per flow
+     * @param number_of_threads
+     * @return the flows that got a new configuration
+     */
+    auto generateFurtherCandidates(MultiLayeredGraph& graph,
+                                   const robin_hood::unordered_set<common::FlowNodeID>& flows,
+                                   std::size_t no_candidate_paths,
+                                   std::size_t number_of_threads)
+        -> robin_hood::unordered_set<common::FlowNodeID>;
+
+    /**
+     * calls task for all indices in [0, count), distributed over the threads
+     * @param count
+     * @param number_of_threads
+     * @param task must be safe to call concurrently for different indices
+     */
+    static auto runInParallel(std::size_t count, std::size_t number_of_threads, const std::function<void(std::size_t)>& task) -> void;
+
     auto removeRejectedFlows(MultiLayeredGraph& graph) -> void;
 
     double total_insert_config_time_ = 0.;
     robin_hood::unordered_set<common::FlowNodeID> active_f_;
     common::NetworkUtilizationList currently_active_utilization_;
+    // route generators of the flows added in the current time step, only used with lazy candidate paths
+    robin_hood::unordered_map<common::FlowNodeID, std::unique_ptr<routing::RouteGenerator>> route_generators_;
 };
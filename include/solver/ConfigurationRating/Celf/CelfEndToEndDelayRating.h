@@ -44,7 +44,7 @@ public:
 
                 auto earliest_arrival = arrival_times[i];
                 auto next_slot = std::ranges::find_if(utilization_.getFreeEgressSlots()[network_link_id.get()], [&](auto& free_slot) {
-                    auto earliest_send_time = std::max(free_slot.last_free_macro_tick, earliest_arrival);
+                    auto earliest_send_time = std::max<std::size_t>(free_slot.last_free_macro_tick, earliest_arrival);
 
                     // 1) slot has not ended before the package arrives
                     auto condition_1 = free_slot.last_free_macro_tick >= earliest_arrival;
@@ -63,7 +63,7 @@ public:
                 }
                 // store the egress slot to be used
                 auto free_slot = *next_slot;
-                auto earliest_send_time = std::max(free_slot.start_time, earliest_arrival);
+                auto earliest_send_time = std::max<std::size_t>(free_slot.start_time, earliest_arrival);
 
                 if(first_hop.size() < i + 1) {
                     first_hop.emplace_back(earliest_send_time);
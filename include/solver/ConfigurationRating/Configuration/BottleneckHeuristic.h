@@ -32,7 +32,8 @@ private:
     {
         auto& freeSlots = utilization_.getFreeEgressSlots()[link.get()];
         return std::transform_reduce(freeSlots.begin(), freeSlots.end(), std::size_t{0}, std::plus<std::size_t>(), [&](auto& slot) {
-            auto& [first, last] = slot;
+            const std::size_t first = slot.start_time;
+            const std::size_t last = slot.last_free_macro_tick;
             // check if flot is before deadline
             if(last < deadline) {
                 return last + 1 - first;
@@ -42,7 +42,7 @@ public:
 
                 auto earliest_arrival = arrival_times[i];
                 auto next_slot = std::ranges::find_if(utilization_.getFreeEgressSlots()[network_link_id.get()], [&](auto& free_slot) {
-                    auto earliest_send_time = std::max(free_slot.start_time, earliest_arrival);
+                    auto earliest_send_time = std::max<std::size_t>(free_slot.start_time, earliest_arrival);
 
                     // 1) slot has not ended before the package arrives
                     auto condition_1 = free_slot.last_free_macro_tick >= earliest_arrival;
@@ -61,7 +61,7 @@ public:
                 }
                 // store the egress slot to be used
                 auto free_slot = *next_slot;
-                auto earliest_send_time = std::max(free_slot.start_time, earliest_arrival);
+                auto earliest_send_time = std::max<std::size_t>(free_slot.start_time, earliest_arrival);
 
                 required_slots[i].emplace_back(std::make_tuple(network_link_id, earliest_send_time, earliest_send_time + current_transmission_delay));
                 arrival_times[i] = earliest_send_time + current_transmission_delay + constant::propagation_delay + constant::processing_delay;
@@ -37,6 +37,32 @@ enum class ConfigPlacementTypes {
     -> bool;
 
 
+/**
+ * Searches the slots placeConfigASAP would reserve without modifying the utilization list.
+ * @param current_config
+ * @param current_flow
+ * @param utilizationList
+ * @return the required slots of every frame in the hyper-cycle or an empty vector if the config can not be scheduled.
+ */
+[[nodiscard]] auto searchSlotsASAP(const graph_structs::Configuration& current_config,
+                                   const graph_structs::Flow& current_flow,
+                                   const common::NetworkUtilizationList& utilizationList)
+    -> std::vector<std::vector<common::SlotReservationRequest>>;
+
+/**
+ * Reserves the slots of all frames of a config, e.g. found by searchSlotsASAP.
+ * @param required_slots
+ * @param current_config
+ * @param current_flow
+ * @param utilizationList
+ */
+auto reserveSlots(const std::vector<std::vector<common::SlotReservationRequest>>& required_slots,
+                  const graph_structs::Configuration& current_config,
+                  const graph_structs::Flow& current_flow,
+                  common::NetworkUtilizationList& utilizationList)
+    -> void;
+
+
 [[nodiscard]] auto placeConfigBalanced(const graph_structs::Configuration& current_config,
                                        const graph_structs::Flow& current_flow,
                                        common::NetworkUtilizationList& utilizationList)
@@ -50,12 +76,12 @@ enum class ConfigPlacementTypes {
  * @param utilizationList
  * @param egress_queue
  * @param latest_offset
- * @return
+ * @return the start time of the reserved slot or std::nullopt if no slot is free
  */
 [[nodiscard]] auto hermesPlacement(const graph_structs::Configuration& configuration,
                                    const graph_structs::Flow& flow,
                                    common::NetworkUtilizationList& utilizationList,
                                    common::NetworkQueueID egress_queue,
                                    std::size_t latest_offset)
-    -> bool;
+    -> std::optional<std::size_t>;
 } // namespace placement
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include <Typedefs.h>
 #include <graph/MultiLayeredGraph.h>
+#include <optional>
 #include <ranges>
 #include <vector>
 
@@ -9,14 +10,14 @@ namespace common {
 
 struct SingleFreeSlot
 {
-    std::size_t start_time;
-    std::size_t last_free_macro_tick;
+    Tick start_time;
+    Tick last_free_macro_tick;
 };
 
 struct SingleReservedSlot
 {
-    std::size_t start_time;
-    std::size_t next_slot_start;
+    Tick start_time;
+    Tick next_slot_start;
     FlowNodeID flow_id;
     ConfigurationNodeID config_id;
 
@@ -34,9 +35,9 @@ struct SingleReservedSlot
 struct SlotReservationRequest
 {
     NetworkQueueID egress_queue;
-    std::size_t start_time;
-    std::size_t next_slot_start;
-    std::size_t arrival_time;
+    Tick start_time;
+    Tick next_slot_start;
+    Tick arrival_time;
 };
 
 using FreeSlots = std::vector<SingleFreeSlot>;
@@ -72,15 +73,24 @@ public:
      */
     auto removeConfigs(const std::vector<FlowNodeID>& flows) -> void;
 
-    [[nodiscard]] auto getReservedSlotsOf(NetworkQueueID egress_queue, FlowNodeID flowNodeId) -> auto
+    [[nodiscard]] auto getReservedSlotsOf(NetworkQueueID egress_queue, FlowNodeID flowNodeId) const -> auto
     {
-        auto x = std::views::all(reserved_egress_slots_[egress_queue.get()])
-            | std::views::filter([flowNodeId](auto& reserved_slot) {
-                     return reserved_slot.flow_id.get() == flowNodeId.get();
-                 });
-        return x;
+        return reserved_egress_slots_[egress_queue.get()]
+            | std::views::filter([flowNodeId](const auto& reserved_slot) {
+                   return reserved_slot.flow_id == flowNodeId;
+               });
     }
 
+    /**
+     * searches the latest free slot starting at or before latest_start that is larger than min_length
+     * @param egress_queue
+     * @param latest_start
+     * @param min_length
+     * @return
+     */
+    [[nodiscard]] auto findLatestFreeSlot(NetworkQueueID egress_queue, std::size_t latest_start, std::size_t min_length) const
+        -> std::optional<SingleFreeSlot>;
+
 
     [[maybe_unused]] auto printFreeTimeSlots(const std::string& name) const -> void;
 
@@ -103,6 +113,8 @@ public:
 
     auto getSubCycle() const -> std::size_t;
 
+    auto getHyperCycle() const -> std::size_t;
+
     auto searchTransmissionOpportunities(const graph_structs::Configuration& current_config,
                                          const graph_structs::Flow& current_flow,
                                          std::size_t first_release_time,
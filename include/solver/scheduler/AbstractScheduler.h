@@ -3,6 +3,10 @@
 #include "graph/MultiLayeredGraph.h"
 #include "solver/UtilizationList.h"
 #include <any>
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <stop_token>
 
 namespace solver {
 
@@ -11,7 +15,11 @@ using solutionSet = std::vector<std::pair<common::FlowNodeID, common::Configurat
 class AbstractScheduler
 {
 public:
-    virtual auto initialize(std::any param) -> void {
+    /**
+     * called before each time step
+     * @param param the ScenarioManager passes a std::reference_wrapper<const MultiLayeredGraph>, the graph is not copied
+     */
+    virtual auto initialize(const std::any& param) -> void {
         // can be overwritten in subclasses if needed
     }
 
@@ -21,9 +29,108 @@ public:
                                      common::NetworkUtilizationList& network_utilization)
         -> solutionSet = 0;
 
+    /**
+     * solves like the overload above, but stops adding flows once the budget is exceeded or a stop is requested.
+     * @param graph
+     * @param active_f
+     * @param req_f
+     * @param network_utilization
+     * @param budget maximum solving time, zero for no limit
+     * @param stop_token
+     * @return the flows scheduled until the stop
+     */
+    [[nodiscard]] auto solve(const MultiLayeredGraph& graph,
+                             const robin_hood::unordered_set<common::FlowNodeID>& active_f,
+                             const robin_hood::unordered_set<common::FlowNodeID>& req_f,
+                             common::NetworkUtilizationList& network_utilization,
+                             const std::chrono::milliseconds budget,
+                             std::stop_token stop_token = {})
+        -> solutionSet
+    {
+        stop_token_ = std::move(stop_token);
+        if(budget.count() > 0) {
+            deadline_ = Clock::now() + budget;
+        }
+        stopped_ = false;
+
+        auto result = solve(graph, active_f, req_f, network_utilization);
+
+        stop_token_ = {};
+        deadline_.reset();
+        return result;
+    }
+
+    /**
+     * @return true if the last budgeted solve was stopped before all flows were handled
+     */
+    [[nodiscard]] virtual auto isStopped() const -> bool
+    {
+        return stopped_;
+    }
+
     [[nodiscard]] virtual auto name() -> std::string = 0;
 
+    /**
+     * creates an independent scheduler with the same configuration, e.g. to run defensive and offensive planning concurrently
+     * @return
+     */
+    [[nodiscard]] virtual auto clone() const -> std::unique_ptr<AbstractScheduler> = 0;
+
+    /**
+     * schedulers not supporting defensive planning are only used for offensive planning
+     * @return true if the scheduler can add flows to an existing schedule
+     */
+    [[nodiscard]] virtual auto supportsDefensivePlanning() const -> bool
+    {
+        return true;
+    }
+
+    /**
+     * further candidate paths of flows that could not be placed are only generated for schedulers considering them
+     * @return true if the scheduler chooses among all configurations of a flow, false if it only uses the first one
+     */
+    [[nodiscard]] virtual auto considersAllConfigurations() const -> bool
+    {
+        return true;
+    }
+
     virtual ~AbstractScheduler() = default;
+
+protected:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * to be checked in the schedulers' loops, the partial solution is returned once a stop is requested
+     * @return true if the budget of the current solve is exceeded or a stop is requested
+     */
+    [[nodiscard]] auto stopRequested() -> bool
+    {
+        const auto stop = stop_token_.stop_requested() or (deadline_.has_value() and Clock::now() >= deadline_.value());
+        stopped_ = stopped_ or stop;
+        return stop;
+    }
+
+    [[nodiscard]] auto getStopToken() const -> std::stop_token
+    {
+        return stop_token_;
+    }
+
+    /**
+     * @return the time left in the current solve, zero if there is no limit
+     */
+    [[nodiscard]] auto getRemainingBudget() const -> std::chrono::milliseconds
+    {
+        if(not deadline_.has_value()) {
+            return std::chrono::milliseconds{0};
+        }
+        const auto remaining = std::chrono::ceil<std::chrono::milliseconds>(deadline_.value() - Clock::now());
+        return std::max(remaining, std::chrono::milliseconds{1});
+    }
+
+private:
+    std::stop_token stop_token_;
+    std::optional<Clock::time_point> deadline_;
+    bool stopped_ = false;
 };
 
 } // namespace solver
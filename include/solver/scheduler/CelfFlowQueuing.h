@@ -25,6 +25,11 @@ public:
         return fmt::format("CelfFlowQueuing-{}", celf_rating::to_int(config_rating_type_));
     };
 
+    [[nodiscard]] auto clone() const -> std::unique_ptr<solver::AbstractScheduler> override
+    {
+        return std::make_unique<CelfFlowQueuing>(*this);
+    }
+
 private:
     [[nodiscard]] auto scheduleSet(const robin_hood::unordered_set<common::FlowNodeID>& set,
                                    common::NetworkUtilizationList& network_utilization) -> solver::solutionSet;
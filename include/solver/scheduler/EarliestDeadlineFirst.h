@@ -6,10 +6,15 @@
 class EarliestDeadlineFirst final : public solver::AbstractScheduler
 {
 public:
-    explicit EarliestDeadlineFirst(MultiLayeredGraph& graph);
+    /**
+     * @param graph
+     * @param batch_admission if set, flows that do not fit into the initial simulation are admitted in batches.
+     *  A batch that can not be admitted is split in half until single flows are left.
+     */
+    explicit EarliestDeadlineFirst(MultiLayeredGraph& graph, bool batch_admission = false);
 
     /**
-     * Note that EDF does not use the NetworkUtilizationList and does not support defensive planning.
+     * Note that EDF simulates all flows from scratch and overwrites the NetworkUtilizationList. Thus, it does not support defensive planning.
      * @param graph
      * @param active_f
      * @param req_f
@@ -27,12 +32,104 @@ public:
         return "EDF";
     }
 
+    auto clone() const -> std::unique_ptr<solver::AbstractScheduler> override
+    {
+        return std::make_unique<EarliestDeadlineFirst>(*this);
+    }
+
+    auto supportsDefensivePlanning() const -> bool override
+    {
+        return false;
+    }
+
+    auto considersAllConfigurations() const -> bool override
+    {
+        return false;
+    }
+
 private:
-    [[nodiscard]] auto simulateEdfPlacement(const solver::solutionSet& configs,
-                                            common::NetworkUtilizationList& utilizationList) const
+    struct Frame
+    {
+        common::ConfigurationNodeID config_id;
+        std::size_t arrival_time;
+        std::size_t frame_size;
+        std::size_t period;
+        std::size_t deadline;
+    };
+
+    struct Transmission
+    {
+        std::size_t start_time;
+        std::size_t next_slot_start;
+        std::size_t arrival_time;
+        std::size_t deadline;
+        std::size_t period;
+        common::FlowNodeID flow_id;
+        common::ConfigurationNodeID config_id;
+    };
+
+    using TimeList = std::vector<std::pair<common::NetworkQueueID, std::size_t>>;
+
+    /**
+     * Simulation state before any egress port is handled at a time >= time.
+     */
+    struct Checkpoint
+    {
+        std::size_t time;
+        std::vector<std::vector<Frame>> inbox;
+        TimeList time_list;
+    };
+
+    /**
+     * Resets the simulation to an empty set of admitted flows.
+     * @param checkpoint_interval distance between two checkpoints, e.g., the sub cycle
+     */
+    auto resetSimulation(std::size_t checkpoint_interval) -> void;
+
+    /**
+     * Simulates the admitted flows together with configs.
+     * The simulation resumes from the latest checkpoint that is not affected by configs.
+     * If no deadline is missed, configs are admitted and the simulation becomes the new reference.
+     * @param configs
+     * @return the flow missing its deadline or nullopt if configs are admitted
+     */
+    [[nodiscard]] auto simulateEdfPlacement(const solver::solutionSet& configs)
         -> std::optional<common::FlowNodeID>;
 
+    /**
+     * Emplaces a frame for every period of the configs' flows at the first egress port of their paths.
+     * @param inbox
+     * @param configs
+     */
+    auto addFrames(std::vector<std::vector<Frame>>& inbox, const solver::solutionSet& configs) const -> void;
+
+    /**
+     * Returns the first time the reference simulation would treat the frames of config differently.
+     * Up to this time, the simulation does not have to be repeated when config is added.
+     * @param config_id
+     * @return
+     */
+    [[nodiscard]] auto findDivergenceTime(common::ConfigurationNodeID config_id) const -> std::size_t;
+
+    /**
+     * admits the candidates in batches, splitting batches that miss a deadline.
+     * @param candidates
+     * @param admitted
+     */
+    auto admitBatched(const solver::solutionSet& candidates, solver::solutionSet& admitted) -> void;
+
+    /**
+     * writes the transmissions of the reference simulation into utilizationList
+     * @param utilizationList
+     */
+    auto applyReservations(common::NetworkUtilizationList& utilizationList) const -> void;
+
     MultiLayeredGraph& graph_;
     std::size_t hyper_cycle_;
-    bool skip_run_ = true;
+    bool batch_admission_;
+
+    // reference simulation of the admitted flows
+    std::size_t checkpoint_interval_ = 1;
+    std::vector<Checkpoint> checkpoints_;
+    std::vector<std::vector<Transmission>> transmissions_;
 };
@@ -5,7 +5,11 @@
 class FirstFit final : public solver::AbstractScheduler
 {
 public:
-    explicit FirstFit(MultiLayeredGraph& graph);
+    /**
+     * @param graph
+     * @param number_of_threads threads searching placements in parallel. The result is the same as for a single thread.
+     */
+    explicit FirstFit(MultiLayeredGraph& graph, std::size_t number_of_threads = 1);
 
     auto solve(const MultiLayeredGraph& graph,
                const robin_hood::unordered_set<common::FlowNodeID>& active_f,
@@ -13,6 +17,13 @@ public:
                common::NetworkUtilizationList& network_utilization)
         -> solver::solutionSet override;
     auto name() -> std::string override;
+    auto clone() const -> std::unique_ptr<solver::AbstractScheduler> override;
+
+    /**
+     * FirstFit only places the first configuration of each flow
+     * @return false
+     */
+    auto considersAllConfigurations() const -> bool override;
 
 private:
     /**
@@ -26,5 +37,21 @@ private:
                    solver::solutionSet& result_set)
         -> void;
 
+    /**
+     * parallel version of add_flows.
+     * The placements of a window of flows are searched in parallel on the same utilization and committed in flow ID order.
+     * A search is repeated if an earlier commit of the window modified one of the flow's links.
+     * One pool of threads searches the next window while the current one is committed, flows sharing a link with the
+     * committed window are searched during their own commit.
+     * @param flow_list sorted flows
+     * @param utilization
+     * @param result_set
+     */
+    auto add_flows_parallel(const std::vector<common::FlowNodeID>& flow_list,
+                            common::NetworkUtilizationList& utilization,
+                            solver::solutionSet& result_set)
+        -> void;
+
     MultiLayeredGraph& graph_;
+    std::size_t number_of_threads_;
 };
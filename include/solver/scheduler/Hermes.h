@@ -26,6 +26,14 @@ public:
 
     auto name() -> std::string override;
 
+    auto clone() const -> std::unique_ptr<solver::AbstractScheduler> override;
+
+    /**
+     * HERMES assumes a single path per flow and only uses the first configuration
+     * @return false
+     */
+    auto considersAllConfigurations() const -> bool override;
+
 private:
     auto divPhases() -> std::optional<robin_hood::unordered_map<common::NetworkQueueID, std::size_t>>;
 
@@ -33,11 +41,15 @@ private:
      * returns the last path segment without a phase assigned or the path segment with the given phase.
      * Note: Hermes assigns phases in reverse order. Therefore the last link in the path without phase is the "next" to get one.
      * @param phases
-     * @param path
+     * @param unassigned_prefix number of leading path segments that might be without phase, advanced by this call
+     * @param config_id
      * @param phi
      * @return
      */
-    static auto getNextPathSegmentForPhase(std::vector<std::size_t>& phases, const std::vector<common::NetworkQueueID>& path, std::size_t phi)
+    auto getNextPathSegmentForPhase(const std::vector<std::size_t>& phases,
+                                    robin_hood::unordered_map<common::ConfigurationNodeID, std::size_t>& unassigned_prefix,
+                                    common::ConfigurationNodeID config_id,
+                                    std::size_t phi) const
         -> std::optional<common::NetworkQueueID>;
 
     auto assignFrameUtilization() -> std::vector<float>;
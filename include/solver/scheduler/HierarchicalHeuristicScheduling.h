@@ -25,6 +25,11 @@ public:
         return fmt::format("H2S-{}-{}", to_int(flow_sorter_type_), to_int(config_rating_type_));
     };
 
+    auto clone() const -> std::unique_ptr<solver::AbstractScheduler> override
+    {
+        return std::make_unique<HierarchicalHeuristicScheduling>(*this);
+    }
+
 private:
     [[nodiscard]] auto scheduleSet(const robin_hood::unordered_set<common::FlowNodeID>& flow_set, common::NetworkUtilizationList& utilization) -> solver::solutionSet;
 
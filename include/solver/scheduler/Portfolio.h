@@ -0,0 +1,46 @@
+#pragma once
+
+#include "AbstractScheduler.h"
+
+/**
+ * Runs several schedulers concurrently and keeps the solution with the highest scheduled traffic.
+ * Every scheduler solves on its own copy of the NetworkUtilizationList. Ties are broken by the shorter solving time.
+ */
+class Portfolio final : public solver::AbstractScheduler
+{
+public:
+    explicit Portfolio(std::vector<std::unique_ptr<solver::AbstractScheduler>> schedulers);
+
+    /**
+     * forwards param to all schedulers without copying it
+     * @param param
+     */
+    auto initialize(const std::any& param) -> void override;
+
+    auto solve(const MultiLayeredGraph& graph,
+               const robin_hood::unordered_set<common::FlowNodeID>& active_f,
+               const robin_hood::unordered_set<common::FlowNodeID>& req_f,
+               common::NetworkUtilizationList& network_utilization)
+        -> solver::solutionSet override;
+
+    auto name() -> std::string override;
+
+    auto clone() const -> std::unique_ptr<solver::AbstractScheduler> override;
+
+    /**
+     * a portfolio plans defensively only if all of its schedulers do
+     * @return
+     */
+    auto supportsDefensivePlanning() const -> bool override;
+
+    /**
+     * further configurations are useful if any of the schedulers considers them
+     * @return
+     */
+    auto considersAllConfigurations() const -> bool override;
+
+    auto isStopped() const -> bool override;
+
+private:
+    std::vector<std::unique_ptr<solver::AbstractScheduler>> schedulers_;
+};
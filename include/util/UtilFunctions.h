@@ -18,12 +18,8 @@ auto vector_contains(const std::vector<T>& vec, const T& val) -> bool
 
 inline auto calculate_hyper_cycle(const MultiLayeredGraph& graph) -> std::size_t
 {
-    return std::transform_reduce(
-        graph.getFlows().cbegin(),
-        graph.getFlows().cend(),
-        std::size_t{1},
-        [](auto v1, auto v2) { return std::lcm(v1, v2); },
-        [](auto key_value) { return key_value.second.period; });
+    // maintained by the graph whenever flows are added or removed
+    return graph.getHyperCycle();
 }
 
 inline auto calculate_hyper_cycle(const std::vector<io::TimeStep>& scenario) -> std::size_t
@@ -1,15 +1,46 @@
+#include "routing/CachedNavigation.h"
+#include "routing/CongestionAwareNavigation.h"
 #include "routing/DijkstraOverlap.h"
+#include "routing/EdgeDisjointNavigation.h"
 #include "routing/KShortest.h"
+#include "routing/PrecomputedNavigation.h"
 #include "solver/scheduler/CelfFlowQueuing.h"
 #include "solver/scheduler/EarliestDeadlineFirst.h"
 #include "solver/scheduler/FirstFit.h"
 #include "solver/scheduler/Hermes.h"
 #include "solver/scheduler/HierarchicalHeuristicScheduling.h"
+#include "solver/scheduler/Portfolio.h"
 #include <IO/InputParser.h>
 #include <IO/OutputLogger.h>
 #include <scenario/ScenarioManager.h>
 #include <util/Timer.h>
 
+auto create_solver(const std::string& algorithm, const ProgramOptions& options, MultiLayeredGraph& graph)
+    -> std::unique_ptr<solver::AbstractScheduler>
+{
+    const std::string algorithm_name = util::to_upper(algorithm);
+    if(algorithm_name == "CELF") {
+        return std::make_unique<CelfFlowQueuing>(
+            graph,
+            static_cast<celf_rating::CelfRatingTypes>(options.getConfigurationRating()),
+            options.getPlacementType());
+    }
+    if(algorithm_name == "EDF") {
+        return std::make_unique<EarliestDeadlineFirst>(graph, options.isEdfBatchAdmission());
+    }
+    if(algorithm_name == "FF" or algorithm_name == "FIRSTFIT") {
+        return std::make_unique<FirstFit>(graph, options.getNumberOfThreads());
+    }
+    if(algorithm_name == "HERMES") {
+        return std::make_unique<Hermes>(graph);
+    }
+    return std::make_unique<HierarchicalHeuristicScheduling>(
+        graph,
+        options.getFlowSorting(),
+        static_cast<configuration_rating::ConfigurationRatingTypes>(options.getConfigurationRating()),
+        options.getPlacementType());
+}
+
 auto main(int argc, char* argv[])
     -> int
 {
@@ -37,24 +68,14 @@ auto main(int argc, char* argv[])
     // Create Solver
     // =============
     std::unique_ptr<solver::AbstractScheduler> solver;
-    const std::string algorithm_name = util::to_upper(options.getAlgorithm());
-    if(algorithm_name == "CELF") {
-        solver = std::make_unique<CelfFlowQueuing>(
-            graph,
-            static_cast<celf_rating::CelfRatingTypes>(options.getConfigurationRating()),
-            options.getPlacementType());
-    } else if(algorithm_name == "EDF") {
-        solver = std::make_unique<EarliestDeadlineFirst>(graph);
-    } else if(algorithm_name == "FF" or algorithm_name == "FIRSTFIT") {
-        solver = std::make_unique<FirstFit>(graph);
-    } else if(algorithm_name == "HERMES") {
-        solver = std::make_unique<Hermes>(graph);
+    if(options.getPortfolio().empty()) {
+        solver = create_solver(options.getAlgorithm(), options, graph);
     } else {
-        solver = std::make_unique<HierarchicalHeuristicScheduling>(
-            graph,
-            options.getFlowSorting(),
-            static_cast<configuration_rating::ConfigurationRatingTypes>(options.getConfigurationRating()),
-            options.getPlacementType());
+        std::vector<std::unique_ptr<solver::AbstractScheduler>> schedulers;
+        for(const auto& algorithm : options.getPortfolio()) {
+            schedulers.emplace_back(create_solver(algorithm, options, graph));
+        }
+        solver = std::make_unique<Portfolio>(std::move(schedulers));
     }
 
     // ================
@@ -64,9 +85,45 @@ auto main(int argc, char* argv[])
     const std::string routing_algorithm = util::to_upper(options.getRoutingAlgorithm());
     if(routing_algorithm == "K_SHORTEST") {
         navigator = std::make_shared<routing::KShortest>();
+    } else if(routing_algorithm == "CONGESTION_AWARE") {
+        navigator = std::make_shared<routing::CongestionAwareNavigation>(options.getCongestionWeight());
+    } else if(routing_algorithm == "EDGE_DISJOINT") {
+        navigator = std::make_shared<routing::EdgeDisjointNavigation>();
     } else {
         navigator = std::make_shared<routing::DijkstraOverlap>();
     }
+    // the congestion aware routes depend on the load of the time step, thus they are neither cached nor precomputed
+    const bool load_dependent_routes = routing_algorithm == "CONGESTION_AWARE";
+    if(load_dependent_routes) {
+        if(options.isPrecomputeRoutes() and not options.isRaw()) {
+            fmt::print("Routes are not precomputed, since {} depends on the load\n", navigator->name());
+        }
+    } else if(options.isLazyCandidatePaths()) {
+        // the candidates are computed on demand by route generators, which bypass a route table
+        if(options.isPrecomputeRoutes() and not options.isRaw()) {
+            fmt::print("Routes are not precomputed, since the candidate paths are computed lazily\n");
+        }
+    } else if(options.isPrecomputeRoutes()) {
+        // flows only go between end devices, thus routing is not required while running the scenario
+        auto precompute_timer = Timer();
+        const auto& route_table_path = options.getRouteTablePath();
+        auto route_table = route_table_path.empty()
+            ? std::nullopt
+            : routing::PrecomputedNavigation::load(route_table_path, navigator, graph, options.getCandidatePaths());
+        if(not route_table.has_value()) {
+            route_table = routing::PrecomputedNavigation::precompute(navigator, graph, options.getCandidatePaths(), options.getNumberOfThreads());
+            if(not route_table_path.empty() and not route_table->save(route_table_path)) {
+                fmt::print("Could not write the route table to {}\n", route_table_path);
+            }
+        }
+        if(not options.isRaw()) {
+            fmt::print("Routes between {} end devices ready after {}s\n", route_table->getNumberOfEndDevices(), precompute_timer.elapsed());
+        }
+        navigator = std::make_shared<routing::PrecomputedNavigation>(std::move(route_table.value()));
+    } else {
+        // the topology never changes, thus flows between known devices can reuse the routes
+        navigator = std::make_shared<routing::CachedNavigation>(std::move(navigator));
+    }
 
     // ============
     // Run Scenario
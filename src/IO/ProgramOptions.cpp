@@ -1,6 +1,7 @@
 #include "solver/ConfigurationRating/CelfRatingFactory.h"
 #include "util/UtilFunctions.h"
 #include <CLI/CLI.hpp>
+#include <algorithm>
 #include <IO/ProgramOptions.h>
 
 ProgramOptions::ProgramOptions(const int argc, char **argv)
@@ -22,7 +23,10 @@ ProgramOptions::ProgramOptions(const int argc, char **argv)
                    "The algorithm/strategy to be used (H2S, CELF, EDF, FF): str [default: H2S]");
 
     app.add_option("--routing", routing_algorithm_,
-                   "The routing algorithm to be used (DIJKSTRA_OVERLAP, K_SHORTEST): str [default: DIJKSTRA_OVERLAP]");
+                   "The routing algorithm to be used (DIJKSTRA_OVERLAP, K_SHORTEST, CONGESTION_AWARE, EDGE_DISJOINT): str [default: DIJKSTRA_OVERLAP]");
+
+    app.add_option("--congestion-weight", congestion_weight_,
+                   "Additional routing weight of a fully reserved link for CONGESTION_AWARE, an idle link weighs 1: int [default: 10]");
 
     app.add_option("-c,--configuration-rating", configuration_rating_,
                    "Select the configuration rating heuristic: int [Default: 1]");
@@ -39,19 +43,45 @@ ProgramOptions::ProgramOptions(const int argc, char **argv)
     app.add_option("--candidate-paths", candidate_paths_,
                    "Number of candidate paths to be considered for routing: int [default: 5]. Some algorithms might overwrite this value.");
 
+    app.add_flag("--lazy-candidate-paths", lazy_candidate_paths_,
+                 "if set, each flow starts with a single candidate path, further ones (up to --candidate-paths) are computed when the scheduler can not place the flow. FF, EDF and HERMES only use the first path and get no further ones.");
+
     app.add_flag("--verify-schedule", verify_schedule,
                  "if set, the schedule will be double checked after the scheduling. This flag is for development.");
 
+    app.add_flag("--edf-batch-admission", edf_batch_admission_,
+                 "if set, EDF admits the remaining flows in batches instead of one by one.");
+
+    app.add_option("--threads", number_of_threads_,
+                   "Number of threads used by the route computation and by algorithms supporting parallel search (FF). With more than one, offensive planning runs concurrently to defensive planning: int [default: 1]");
+
+    app.add_option("--portfolio", portfolio_,
+                   "Comma separated algorithms solving each time step in parallel, the solution with the highest traffic is used. Overwrites --algorithm. HERMES or CELF with LowPeriodLongPaths limit all members to a single candidate path.")
+        ->delimiter(',');
+
+    app.add_flag("--precompute-routes", precompute_routes_,
+                 "if set, the routes between all end devices are computed in parallel before the first time step.");
+
+    app.add_option("--route-table", route_table_path_,
+                   "File of precomputed routes, used if it matches the network and number of candidate paths, otherwise it is (re)written. Implies --precompute-routes");
+
+    app.add_option("--step-budget-ms", step_budget_ms_,
+                   "Solving time budget per time step in milliseconds, the flows scheduled so far are used when it is exceeded: int [default: 0 (no limit)]");
+
     try {
         app.parse(argc, argv);
     } catch(const CLI::ParseError &e) {
         std::exit(app.exit(e));
     }
 
-    if(util::to_lower(algorithm_) == "hermes") {
-        candidate_paths_ = 1;
-    } else if(util::to_lower(algorithm_) == "celf" and configuration_rating_ == to_int(celf_rating::CelfRatingTypes::LowPeriodLongPaths)) {
-        // greedy algorithm from "Optimization algorithms for the scheduling of IEEE 802.1 Time-Sensitive Networking (TSN)"
+    // the portfolio overwrites the algorithm and all of its members share the candidate paths
+    const auto algorithms = portfolio_.empty() ? std::vector{algorithm_} : portfolio_;
+    const auto single_candidate_path = std::ranges::any_of(algorithms, [this](const auto &algorithm) {
+        // CELF with LowPeriodLongPaths is the greedy algorithm from "Optimization algorithms for the scheduling of IEEE 802.1 Time-Sensitive Networking (TSN)"
+        return util::to_lower(algorithm) == "hermes"
+            or (util::to_lower(algorithm) == "celf" and configuration_rating_ == to_int(celf_rating::CelfRatingTypes::LowPeriodLongPaths));
+    });
+    if(single_candidate_path) {
         candidate_paths_ = 1;
     }
 }
@@ -98,7 +128,39 @@ auto ProgramOptions::getCandidatePaths() const -> std::size_t
 {
     return candidate_paths_;
 }
+auto ProgramOptions::isLazyCandidatePaths() const -> bool
+{
+    return lazy_candidate_paths_;
+}
 auto ProgramOptions::isVerifySchedule() const -> bool
 {
     return verify_schedule;
+}
+auto ProgramOptions::isEdfBatchAdmission() const -> bool
+{
+    return edf_batch_admission_;
+}
+auto ProgramOptions::getNumberOfThreads() const -> std::size_t
+{
+    return number_of_threads_;
+}
+auto ProgramOptions::getPortfolio() const -> const std::vector<std::string>&
+{
+    return portfolio_;
+}
+auto ProgramOptions::getStepBudget() const -> std::size_t
+{
+    return step_budget_ms_;
+}
+auto ProgramOptions::getCongestionWeight() const -> std::size_t
+{
+    return congestion_weight_;
+}
+auto ProgramOptions::isPrecomputeRoutes() const -> bool
+{
+    return precompute_routes_ or not route_table_path_.empty();
+}
+auto ProgramOptions::getRouteTablePath() const -> const std::string&
+{
+    return route_table_path_;
 }
\ No newline at end of file
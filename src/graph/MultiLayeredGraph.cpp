@@ -1,6 +1,7 @@
 #include "graph/MultiLayeredGraph.h"
+#include <algorithm>
 #include <fmt/core.h>
-#include <graph/GraphStructOperations.h>
+#include <numeric>
 
 
 MultiLayeredGraph::MultiLayeredGraph()
@@ -8,6 +9,38 @@ MultiLayeredGraph::MultiLayeredGraph()
     network_forward_offset_.emplace_back(0);
 }
 
+MultiLayeredGraph::MultiLayeredGraph(const MultiLayeredGraph& other)
+    : flows_(other.flows_),
+      period_histogram_(other.period_histogram_),
+      hyper_cycle_(other.hyper_cycle_),
+      gcd_period_(other.gcd_period_),
+      config_nodes_(other.config_nodes_),
+      path_pool_(other.path_pool_),
+      unused_path_hops_(other.unused_path_hops_),
+      interned_paths_(other.interned_paths_),
+      free_path_ids_(other.free_path_ids_),
+      queue_users_(other.queue_users_),
+      used_by_positions_(other.used_by_positions_),
+      unused_used_by_positions_(other.unused_used_by_positions_),
+      used_by_position_offsets_(other.used_by_position_offsets_),
+      network_forward_offset_(other.network_forward_offset_),
+      network_forward_edges_(other.network_forward_edges_),
+      network_queue_sources_(other.network_queue_sources_),
+      network_ingress_queues_(other.network_ingress_queues_),
+      config_id_counter_(other.config_id_counter_)
+{
+    // the copied configs still view the pool of other
+    relinkPaths();
+}
+
+auto MultiLayeredGraph::operator=(const MultiLayeredGraph& other) -> MultiLayeredGraph&
+{
+    if(this != &other) {
+        *this = MultiLayeredGraph(other);
+    }
+    return *this;
+}
+
 auto MultiLayeredGraph::getNumberOfFlows() const -> std::size_t
 {
     return flows_.size();
@@ -24,23 +57,31 @@ auto MultiLayeredGraph::getFlow(const common::FlowNodeID flow_id) const -> const
     return flows_.at(flow_id);
 }
 
-auto MultiLayeredGraph::getFlows() const -> const robin_hood::unordered_map<common::FlowNodeID, graph_structs::Flow>&
+auto MultiLayeredGraph::getFlows() const -> const graph_structs::SlotMap<common::FlowNodeID, graph_structs::Flow>&
 {
     return flows_;
 }
 
 auto MultiLayeredGraph::insertNetworkDevice(const std::vector<common::NetworkNodeID>& neighbors) -> void
 {
+    const auto device = common::NetworkNodeID{static_cast<common::UnderlyingID>(network_forward_offset_.size() - 1)};
     const auto next_index = network_forward_offset_[network_forward_offset_.size() - 1];
     network_forward_offset_.emplace_back(next_index + neighbors.size());
 
     const bool end_device = neighbors.size() == 1;
 
     for(const auto neighbor : neighbors) {
-        const auto next_id = network_forward_edges_.size();
+        const auto next_id = common::checkedNarrow<common::UnderlyingID>(network_forward_edges_.size(), "egress queue id");
         network_forward_edges_.emplace_back(graph_structs::EgressQueue{.id = common::NetworkQueueID{next_id},
                                                                        .destination = neighbor,
                                                                        .end_device = end_device});
+        queue_users_.emplace_back();
+        network_queue_sources_.emplace_back(device);
+
+        if(network_ingress_queues_.size() <= neighbor.get()) {
+            network_ingress_queues_.resize(neighbor.get() + 1);
+        }
+        network_ingress_queues_[neighbor.get()].emplace_back(next_id);
     }
 }
 
@@ -53,6 +94,19 @@ auto MultiLayeredGraph::getEgressQueuesOf(const common::NetworkNodeID device) co
     return complete.subspan(start_offset, length);
 }
 
+auto MultiLayeredGraph::getIngressQueuesOf(const common::NetworkNodeID device) const -> std::span<const common::NetworkQueueID>
+{
+    if(device.get() >= network_ingress_queues_.size()) {
+        return {};
+    }
+    return network_ingress_queues_[device.get()];
+}
+
+auto MultiLayeredGraph::getSourceOf(const common::NetworkQueueID queue_id) const -> common::NetworkNodeID
+{
+    return network_queue_sources_.at(queue_id.get());
+}
+
 auto MultiLayeredGraph::getEgressQueue(const common::NetworkQueueID queue_id) const -> const graph_structs::EgressQueue&
 {
     return network_forward_edges_.at(queue_id.get());
@@ -69,9 +123,51 @@ auto MultiLayeredGraph::getEgressQueues() const -> std::span<const graph_structs
     return complete;
 }
 
+auto MultiLayeredGraph::getUsersOf(const common::NetworkQueueID queue_id) const -> std::span<const common::ConfigurationNodeID>
+{
+    return queue_users_.at(queue_id.get());
+}
+
 auto MultiLayeredGraph::addFlow(graph_structs::Flow f) -> void
 {
-    flows_[f.id] = std::move(f);
+    const auto id = f.id;
+    if(flows_.contains(id)) {
+        removePeriod(flows_.at(id).period);
+    }
+
+    ++period_histogram_[f.period];
+    hyper_cycle_ = std::lcm(hyper_cycle_, f.period);
+    gcd_period_ = std::gcd(gcd_period_, f.period);
+
+    flows_.insert_or_assign(id, std::move(f));
+}
+
+auto MultiLayeredGraph::removePeriod(const std::size_t period) -> void
+{
+    auto& count = period_histogram_.at(period);
+    --count;
+    if(count > 0) {
+        return;
+    }
+
+    // lcm and gcd can't be undone, thus we fold the remaining distinct periods
+    period_histogram_.erase(period);
+    hyper_cycle_ = 1;
+    gcd_period_ = 0;
+    for(const auto& [remaining_period, flows] : period_histogram_) {
+        hyper_cycle_ = std::lcm(hyper_cycle_, remaining_period);
+        gcd_period_ = std::gcd(gcd_period_, remaining_period);
+    }
+}
+
+auto MultiLayeredGraph::getHyperCycle() const -> std::size_t
+{
+    return hyper_cycle_;
+}
+
+auto MultiLayeredGraph::getGcdPeriod() const -> std::size_t
+{
+    return gcd_period_;
 }
 
 auto MultiLayeredGraph::removeFlow(common::FlowNodeID const id) -> void
@@ -81,12 +177,29 @@ auto MultiLayeredGraph::removeFlow(common::FlowNodeID const id) -> void
     }
     const auto& current_flow = flows_.at(id);
     std::ranges::for_each(current_flow.configurations, [&](auto config_id) {
-        for(auto link_id : getConfiguration(config_id).path) {
-            graph_struct_operations::unuse(getEgressQueue(link_id), config_id);
-        }
+        unuseEgressQueues(config_id);
+        releasePath(getConfiguration(config_id).path_id);
         config_nodes_.erase(config_id);
     });
+    removePeriod(current_flow.period);
     flows_.erase(id);
+
+    // compact once most of the pool is garbage
+    if(unused_path_hops_ > path_pool_.size() / 2) {
+        rebuildPathPool(path_pool_.size() - unused_path_hops_);
+    }
+    if(unused_used_by_positions_ > used_by_positions_.size() / 2) {
+        std::vector<std::size_t> positions;
+        positions.reserve(used_by_positions_.size() - unused_used_by_positions_);
+        for(auto& [config_id, offset] : used_by_position_offsets_) {
+            const auto hops = getConfiguration(config_id).path.size();
+            const auto new_offset = positions.size();
+            positions.insert(positions.end(), std::next(used_by_positions_.begin(), offset), std::next(used_by_positions_.begin(), offset + hops));
+            offset = new_offset;
+        }
+        used_by_positions_ = std::move(positions);
+        unused_used_by_positions_ = 0;
+    }
 }
 
 
@@ -113,21 +226,162 @@ auto MultiLayeredGraph::getNumberOfConfigs() const -> std::size_t
     return config_nodes_.size();
 }
 
-auto MultiLayeredGraph::insertConfiguration(const common::FlowNodeID flow, const std::vector<common::NetworkQueueID>& path) -> common::ConfigurationNodeID
+auto MultiLayeredGraph::insertConfiguration(const common::FlowNodeID flow, const std::span<const common::NetworkQueueID> path) -> common::ConfigurationNodeID
 {
     // to make this thread safe we would have to lock the config_nodes_ vector
-    auto id = common::ConfigurationNodeID{config_id_counter_};
+    auto id = common::ConfigurationNodeID{common::checkedNarrow<common::UnderlyingID>(config_id_counter_, "configuration id")};
     ++config_id_counter_;
-    config_nodes_[id] = graph_structs::Configuration{.id = id, .flow = flow, .path = std::move(path)};
+
+    const auto path_id = internPath(path);
+    config_nodes_.insert_or_assign(id, graph_structs::Configuration{.id = id, .flow = flow, .path = getPath(path_id), .path_id = path_id});
 
     return id;
 }
 
+auto MultiLayeredGraph::useEgressQueues(const common::ConfigurationNodeID id) -> void
+{
+    const auto& config = getConfiguration(id);
+    used_by_position_offsets_.insert_or_assign(id, used_by_positions_.size());
+    for(const auto link_id : config.path) {
+        auto& used_by = queue_users_[link_id.get()];
+        used_by_positions_.emplace_back(used_by.size());
+        used_by.emplace_back(id);
+    }
+}
+
+auto MultiLayeredGraph::unuseEgressQueues(const common::ConfigurationNodeID id) -> void
+{
+    if(not used_by_position_offsets_.contains(id)) {
+        return;
+    }
+    const auto& path = getConfiguration(id).path;
+    const auto offset = used_by_position_offsets_.at(id);
+    for(std::size_t hop = 0; hop < path.size(); ++hop) {
+        auto& used_by = queue_users_[path[hop].get()];
+        const auto position = used_by_positions_[offset + hop];
+        const auto last_user = used_by.back();
+        used_by[position] = last_user;
+        used_by.pop_back();
+
+        if(last_user.get() != id.get()) {
+            // paths are short, thus finding the hop of the moved user is cheap compared to searching the users
+            const auto& last_user_path = getConfiguration(last_user).path;
+            const auto last_user_hop = static_cast<std::size_t>(std::ranges::distance(last_user_path.begin(), std::ranges::find(last_user_path, path[hop])));
+            used_by_positions_[used_by_position_offsets_.at(last_user) + last_user_hop] = position;
+        }
+    }
+    unused_used_by_positions_ += path.size();
+    used_by_position_offsets_.erase(id);
+}
+
+auto MultiLayeredGraph::getNumberOfPaths() const -> std::size_t
+{
+    return path_ids_.size();
+}
+
+auto MultiLayeredGraph::getPath(const common::PathID path_id) const -> std::span<const common::NetworkQueueID>
+{
+    const auto& interned_path = interned_paths_.at(path_id.get());
+    return std::span{path_pool_}.subspan(interned_path.offset, interned_path.length);
+}
+
+auto MultiLayeredGraph::PathHash::operator()(const std::span<const common::NetworkQueueID> path) const noexcept -> std::size_t
+{
+    auto seed = robin_hood::hash_int(path.size());
+    for(const auto hop : path) {
+        seed ^= robin_hood::hash_int(hop.get()) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    }
+    return seed;
+}
+
+auto MultiLayeredGraph::PathEqual::operator()(const std::span<const common::NetworkQueueID> lhs, const std::span<const common::NetworkQueueID> rhs) const noexcept -> bool
+{
+    return std::ranges::equal(lhs, rhs);
+}
+
+auto MultiLayeredGraph::internPath(const std::span<const common::NetworkQueueID> path) -> common::PathID
+{
+    if(const auto iter = path_ids_.find(path); iter != path_ids_.end()) {
+        ++interned_paths_[iter->second.get()].references;
+        return iter->second;
+    }
+
+    // growing the pool would invalidate the views of all configs, thus we move them to a new pool ourselves
+    if(path_pool_.size() + path.size() > path_pool_.capacity()) {
+        const auto used_hops = path_pool_.size() - unused_path_hops_ + path.size();
+        rebuildPathPool(std::max(2 * used_hops, std::size_t{64}));
+    }
+    const auto offset = path_pool_.size();
+    path_pool_.insert(path_pool_.end(), path.begin(), path.end());
+
+    auto path_id = common::PathID{static_cast<common::UnderlyingID>(interned_paths_.size())};
+    if(free_path_ids_.empty()) {
+        interned_paths_.emplace_back();
+    } else {
+        path_id = free_path_ids_.back();
+        free_path_ids_.pop_back();
+    }
+    interned_paths_[path_id.get()] = InternedPath{.offset = offset, .length = path.size(), .references = 1};
+    path_ids_.emplace(getPath(path_id), path_id);
+
+    return path_id;
+}
+
+auto MultiLayeredGraph::releasePath(const common::PathID path_id) -> void
+{
+    auto& interned_path = interned_paths_[path_id.get()];
+    --interned_path.references;
+    if(interned_path.references > 0) {
+        return;
+    }
+
+    path_ids_.erase(getPath(path_id));
+    free_path_ids_.emplace_back(path_id);
+    unused_path_hops_ += interned_path.length;
+}
+
+auto MultiLayeredGraph::rebuildPathPool(const std::size_t capacity) -> void
+{
+    std::vector<common::NetworkQueueID> pool;
+    pool.reserve(capacity);
+    for(auto& interned_path : interned_paths_) {
+        if(interned_path.references == 0) {
+            continue;
+        }
+        const auto offset = pool.size();
+        const auto hops = std::span{path_pool_}.subspan(interned_path.offset, interned_path.length);
+        pool.insert(pool.end(), hops.begin(), hops.end());
+        interned_path.offset = offset;
+    }
+
+    path_pool_ = std::move(pool);
+    unused_path_hops_ = 0;
+    relinkPaths();
+}
+
+auto MultiLayeredGraph::relinkPaths() -> void
+{
+    for(auto& [config_id, config] : config_nodes_) {
+        config.path = getPath(config.path_id);
+    }
+
+    path_ids_.clear();
+    for(common::UnderlyingID i = 0; i < interned_paths_.size(); ++i) {
+        if(interned_paths_[i].references > 0) {
+            path_ids_.emplace(getPath(common::PathID{i}), common::PathID{i});
+        }
+    }
+}
+
 auto MultiLayeredGraph::getConfiguration(const common::ConfigurationNodeID id) -> graph_structs::Configuration&
 {
     return config_nodes_.at(id);
 }
-auto MultiLayeredGraph::getConfigurations() const -> const robin_hood::unordered_map<common::ConfigurationNodeID, graph_structs::Configuration>&
+auto MultiLayeredGraph::getConfiguration(const common::ConfigurationNodeID id) const -> const graph_structs::Configuration&
+{
+    return config_nodes_.at(id);
+}
+auto MultiLayeredGraph::getConfigurations() const -> const graph_structs::SlotMap<common::ConfigurationNodeID, graph_structs::Configuration>&
 {
     return config_nodes_;
 }
@@ -0,0 +1,52 @@
+#include "routing/AbstractNavigation.h"
+#include "util/UtilFunctions.h"
+
+namespace routing {
+
+namespace {
+
+/**
+ * asks the navigator for one more candidate on every call and returns the first one that was not returned before.
+ * This also works for navigators whose routes change between the calls, e.g. with the load.
+ */
+class RecomputingRouteGenerator final : public RouteGenerator
+{
+public:
+    RecomputingRouteGenerator(AbstractNavigation& navigator, const common::NetworkNodeID source, const common::NetworkNodeID destination)
+        : navigator_(navigator),
+          source_(source),
+          destination_(destination)
+    {}
+
+    auto next(const MultiLayeredGraph& network) -> std::optional<std::vector<common::NetworkQueueID>> override
+    {
+        if(exhausted_) {
+            return std::nullopt;
+        }
+        for(auto& route : navigator_.findRoutes(source_, destination_, network, returned_routes_.size() + 1)) {
+            if(not util::vector_contains(returned_routes_, route)) {
+                returned_routes_.emplace_back(route);
+                return route;
+            }
+        }
+        exhausted_ = true;
+        return std::nullopt;
+    }
+
+private:
+    AbstractNavigation& navigator_;
+    common::NetworkNodeID source_;
+    common::NetworkNodeID destination_;
+    std::vector<std::vector<common::NetworkQueueID>> returned_routes_;
+    bool exhausted_ = false;
+};
+
+} // namespace
+
+auto AbstractNavigation::createRouteGenerator(const common::NetworkNodeID source, const common::NetworkNodeID destination)
+    -> std::unique_ptr<RouteGenerator>
+{
+    return std::make_unique<RecomputingRouteGenerator>(*this, source, destination);
+}
+
+} // namespace routing
@@ -0,0 +1,61 @@
+#include "routing/CachedNavigation.h"
+#include <mutex>
+
+namespace routing {
+
+CachedNavigation::CachedNavigation(std::shared_ptr<AbstractNavigation> navigator)
+    : navigator_(std::move(navigator))
+{}
+
+auto CachedNavigation::name() -> std::string
+{
+    return navigator_->name();
+}
+
+auto CachedNavigation::findRoutes(const common::NetworkNodeID source, const common::NetworkNodeID destination,
+                                  const MultiLayeredGraph &network,
+                                  const std::size_t number_of_candidates)
+    -> std::vector<std::vector<common::NetworkQueueID>>
+{
+    const auto key = RouteKey{.source = source, .destination = destination, .number_of_candidates = number_of_candidates};
+    {
+        const std::shared_lock lock(routes_mutex_);
+        if(const auto iter = routes_.find(key); iter != routes_.end()) {
+            ++cache_hits_;
+            return iter->second;
+        }
+    }
+
+    // two threads might compute the same routes, both count as a miss but the second one does not overwrite the first
+    ++cache_misses_;
+    auto routes = navigator_->findRoutes(source, destination, network, number_of_candidates);
+    const std::unique_lock lock(routes_mutex_);
+    routes_.emplace(key, routes);
+    return routes;
+}
+
+auto CachedNavigation::createRouteGenerator(const common::NetworkNodeID source, const common::NetworkNodeID destination)
+    -> std::unique_ptr<RouteGenerator>
+{
+    return navigator_->createRouteGenerator(source, destination);
+}
+
+auto CachedNavigation::getNumberOfCacheHits() const -> std::size_t
+{
+    return cache_hits_;
+}
+
+auto CachedNavigation::getNumberOfCacheMisses() const -> std::size_t
+{
+    return cache_misses_;
+}
+
+auto CachedNavigation::RouteKeyHash::operator()(const RouteKey &key) const noexcept -> std::size_t
+{
+    auto seed = robin_hood::hash_int(key.source.get());
+    seed ^= robin_hood::hash_int(key.destination.get()) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    seed ^= robin_hood::hash_int(key.number_of_candidates) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    return seed;
+}
+
+} // namespace routing
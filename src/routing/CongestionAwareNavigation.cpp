@@ -0,0 +1,68 @@
+#include "routing/CongestionAwareNavigation.h"
+#include "routing/DijkstraWorkspace.h"
+#include "util/UtilFunctions.h"
+#include <cmath>
+#include <numeric>
+
+namespace routing {
+
+CongestionAwareNavigation::CongestionAwareNavigation(const std::size_t congestion_weight)
+    : congestion_weight_(static_cast<std::int64_t>(congestion_weight))
+{}
+
+auto CongestionAwareNavigation::name() -> std::string
+{
+    return "CongestionAware";
+}
+
+auto CongestionAwareNavigation::updateUtilization(const MultiLayeredGraph &network,
+                                                  const common::NetworkUtilizationList &utilization) -> void
+{
+    congested_queues_.clear();
+    const auto hyper_cycle = static_cast<double>(std::max(utilization.getHyperCycle(), std::size_t{1}));
+    const auto &reserved_egress_slots = utilization.getReservedEgressSlots();
+    for(std::size_t queue = 0; queue < std::min(reserved_egress_slots.size(), network.getNumberOfEgressQueues()); ++queue) {
+        const auto reserved_time = std::transform_reduce(reserved_egress_slots[queue].begin(), reserved_egress_slots[queue].end(),
+                                                         std::size_t{0},
+                                                         std::plus<>(),
+                                                         [](const auto &slot) { return slot.next_slot_start - slot.start_time; });
+        const auto load_weight = std::llround(static_cast<double>(congestion_weight_) * static_cast<double>(reserved_time) / hyper_cycle);
+        if(load_weight > 0) {
+            congested_queues_.emplace_back(common::NetworkQueueID{static_cast<common::UnderlyingID>(queue)}, 1 + load_weight);
+        }
+    }
+}
+
+auto CongestionAwareNavigation::findRoutes(const common::NetworkNodeID source, const common::NetworkNodeID destination,
+                                           const MultiLayeredGraph &network,
+                                           const std::size_t number_of_candidates)
+    -> std::vector<std::vector<common::NetworkQueueID>>
+{
+    // one workspace per thread, so that consecutive flows don't allocate the search state again
+    thread_local DijkstraWorkspace workspace;
+    workspace.resetWeights();
+    for(const auto &[queue_id, weight] : congested_queues_) {
+        workspace.setWeight(queue_id, weight);
+    }
+
+    // collect different paths
+    std::vector<std::vector<common::NetworkQueueID>> candidate_paths;
+
+    auto duplicate_counter = 0;
+    while(candidate_paths.size() < number_of_candidates and duplicate_counter < DUPLICATE_PATH_LIMIT) {
+        auto temp_path = workspace.shortestPath(source, destination, network);
+        for(const auto &hop : temp_path) {
+            // modify weight
+            workspace.setWeight(hop, workspace.getWeight(hop) + 2);
+        }
+
+        if(util::vector_contains(candidate_paths, temp_path)) {
+            ++duplicate_counter;
+        } else {
+            candidate_paths.emplace_back(temp_path);
+        }
+    }
+    return candidate_paths;
+}
+
+} // namespace routing
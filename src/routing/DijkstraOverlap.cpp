@@ -1,9 +1,65 @@
 #include "routing/DijkstraOverlap.h"
-#include "routing/RoutingUtil.h"
+#include "routing/DijkstraWorkspace.h"
 #include "util/UtilFunctions.h"
+#include "util/robin_hood.h"
 
 namespace routing {
 
+namespace {
+
+/**
+ * keeps the increased weights between the calls, thus every call continues the Dijkstra overlap search of the previous one.
+ * Other generators may use the thread local workspace in between, thus the weights are replayed on every call.
+ */
+class DijkstraOverlapGenerator final : public RouteGenerator
+{
+public:
+    DijkstraOverlapGenerator(const common::NetworkNodeID source, const common::NetworkNodeID destination, const int duplicate_path_limit)
+        : source_(source),
+          destination_(destination),
+          duplicate_path_limit_(duplicate_path_limit)
+    {}
+
+    auto next(const MultiLayeredGraph &network) -> std::optional<std::vector<common::NetworkQueueID>> override
+    {
+        // one workspace per thread, so that consecutive flows don't allocate the search state again
+        thread_local DijkstraWorkspace workspace;
+        workspace.resetWeights();
+        for(const auto &[queue_id, weight] : weights_) {
+            workspace.setWeight(queue_id, weight);
+        }
+
+        while(duplicate_counter_ < duplicate_path_limit_) {
+            auto temp_path = workspace.shortestPath(source_, destination_, network);
+            for(const auto &hop : temp_path) {
+                // modify weight
+                const auto weight = workspace.getWeight(hop) + 2;
+                workspace.setWeight(hop, weight);
+                weights_[hop] = weight;
+            }
+
+            if(util::vector_contains(candidate_paths_, temp_path)) {
+                ++duplicate_counter_;
+            } else {
+                candidate_paths_.emplace_back(temp_path);
+                return temp_path;
+            }
+        }
+        return std::nullopt;
+    }
+
+private:
+    common::NetworkNodeID source_;
+    common::NetworkNodeID destination_;
+    int duplicate_path_limit_;
+    // weights of all edges used by a path so far
+    robin_hood::unordered_map<common::NetworkQueueID, std::int64_t> weights_;
+    std::vector<std::vector<common::NetworkQueueID>> candidate_paths_;
+    int duplicate_counter_ = 0;
+};
+
+} // namespace
+
 auto DijkstraOverlap::name() -> std::string
 {
     return "DijkstraOverlap";
@@ -15,21 +71,19 @@ auto DijkstraOverlap::findRoutes(const common::NetworkNodeID source, const commo
                                  const std::size_t number_of_candidates)
     -> std::vector<std::vector<common::NetworkQueueID>>
 {
+    // one workspace per thread, so that consecutive flows don't allocate the search state again
+    thread_local DijkstraWorkspace workspace;
+    workspace.resetWeights();
+
     // collect different paths
-    WeightMap edge_weights;
     std::vector<std::vector<common::NetworkQueueID>> candidate_paths;
 
     auto duplicate_counter = 0;
     while(candidate_paths.size() < number_of_candidates and duplicate_counter < DUPLICATE_PATH_LIMIT) {
-        auto temp_path = getDijkstraShortestPath(source, destination, network, edge_weights);
+        auto temp_path = workspace.shortestPath(source, destination, network);
         for(const auto &hop : temp_path) {
             // modify weight
-            int64_t weight = 1;
-            if(edge_weights.contains(hop)) {
-                weight = edge_weights[hop];
-            }
-            weight += 2;
-            edge_weights[hop] = weight;
+            workspace.setWeight(hop, workspace.getWeight(hop) + 2);
         }
 
         if(util::vector_contains(candidate_paths, temp_path)) {
@@ -41,4 +95,10 @@ auto DijkstraOverlap::findRoutes(const common::NetworkNodeID source, const commo
     return candidate_paths;
 }
 
-} // namespace routing
\ No newline at end of file
+auto DijkstraOverlap::createRouteGenerator(const common::NetworkNodeID source, const common::NetworkNodeID destination)
+    -> std::unique_ptr<RouteGenerator>
+{
+    return std::make_unique<DijkstraOverlapGenerator>(source, destination, DUPLICATE_PATH_LIMIT);
+}
+
+} // namespace routing
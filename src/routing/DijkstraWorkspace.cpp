@@ -0,0 +1,278 @@
+#include "routing/DijkstraWorkspace.h"
+#include <algorithm>
+#include <fmt/core.h>
+#include <limits>
+#include <stdexcept>
+
+namespace routing {
+
+auto DijkstraWorkspace::setWeight(const common::NetworkQueueID queue_id, const std::int64_t weight) -> void
+{
+    if(weights_.size() <= queue_id.get()) {
+        weights_.resize(queue_id.get() + 1);
+        weight_stamps_.resize(queue_id.get() + 1, 0);
+    }
+    weights_[queue_id.get()] = weight;
+    weight_stamps_[queue_id.get()] = weight_epoch_;
+    if(weight != REMOVED) {
+        max_weight_ = std::max(max_weight_, weight);
+    }
+}
+
+auto DijkstraWorkspace::getWeight(const common::NetworkQueueID queue_id) const -> std::int64_t
+{
+    return hasWeight(queue_id) ? weights_[queue_id.get()] : std::int64_t{1};
+}
+
+auto DijkstraWorkspace::removeEdge(const common::NetworkQueueID queue_id) -> void
+{
+    setWeight(queue_id, REMOVED);
+}
+
+auto DijkstraWorkspace::isRemoved(const common::NetworkQueueID queue_id) const -> bool
+{
+    return hasWeight(queue_id) and weights_[queue_id.get()] == REMOVED;
+}
+
+auto DijkstraWorkspace::hasWeight(const common::NetworkQueueID queue_id) const -> bool
+{
+    return queue_id.get() < weight_stamps_.size() and weight_stamps_[queue_id.get()] == weight_epoch_;
+}
+
+auto DijkstraWorkspace::resetWeights() -> void
+{
+    ++weight_epoch_;
+    if(weight_epoch_ == std::numeric_limits<std::uint32_t>::max()) {
+        std::ranges::fill(weight_stamps_, 0);
+        weight_epoch_ = 1;
+    }
+    max_weight_ = 1;
+}
+
+auto DijkstraWorkspace::HeapFrontier::clear(const std::int64_t /*max_weight*/) -> void
+{
+    heap_.clear();
+}
+
+auto DijkstraWorkspace::HeapFrontier::push(const common::NetworkNodeID node, const std::int64_t distance) -> void
+{
+    heap_.emplace_back(node, distance);
+    std::ranges::push_heap(heap_, std::greater(), &NodeDistancePair::second);
+}
+
+auto DijkstraWorkspace::HeapFrontier::empty() const -> bool
+{
+    return heap_.empty();
+}
+
+auto DijkstraWorkspace::HeapFrontier::minDistance() -> std::int64_t
+{
+    return heap_.front().second;
+}
+
+auto DijkstraWorkspace::HeapFrontier::pop() -> NodeDistancePair
+{
+    std::ranges::pop_heap(heap_, std::greater(), &NodeDistancePair::second);
+    const auto top = heap_.back();
+    heap_.pop_back();
+    return top;
+}
+
+auto DijkstraWorkspace::BucketFrontier::clear(const std::int64_t max_weight) -> void
+{
+    // all queued distances lie within [current_distance_, current_distance_ + max_weight], thus they never collide
+    number_of_buckets_ = static_cast<std::size_t>(max_weight) + 1;
+    if(buckets_.size() < number_of_buckets_) {
+        buckets_.resize(number_of_buckets_);
+    }
+    std::ranges::for_each(buckets_, [](auto &bucket) { bucket.clear(); });
+    current_distance_ = 0;
+    size_ = 0;
+}
+
+auto DijkstraWorkspace::BucketFrontier::push(const common::NetworkNodeID node, const std::int64_t distance) -> void
+{
+    buckets_[static_cast<std::size_t>(distance) % number_of_buckets_].emplace_back(node);
+    ++size_;
+}
+
+auto DijkstraWorkspace::BucketFrontier::empty() const -> bool
+{
+    return size_ == 0;
+}
+
+auto DijkstraWorkspace::BucketFrontier::minDistance() -> std::int64_t
+{
+    while(buckets_[static_cast<std::size_t>(current_distance_) % number_of_buckets_].empty()) {
+        ++current_distance_;
+    }
+    return current_distance_;
+}
+
+auto DijkstraWorkspace::BucketFrontier::pop() -> NodeDistancePair
+{
+    auto &bucket = buckets_[static_cast<std::size_t>(minDistance()) % number_of_buckets_];
+    const auto node = bucket.back();
+    bucket.pop_back();
+    --size_;
+    return {node, current_distance_};
+}
+
+auto DijkstraWorkspace::prepare(const MultiLayeredGraph &network) -> void
+{
+    const auto number_of_nodes = network.getNumberOfNetworkNodes();
+    for(auto *side : {&forward_, &backward_}) {
+        if(side->distances.size() < number_of_nodes) {
+            side->distances.resize(number_of_nodes);
+            side->links.resize(number_of_nodes);
+            side->distance_stamps.resize(number_of_nodes, 0);
+            side->visited_stamps.resize(number_of_nodes, 0);
+        }
+    }
+
+    ++search_epoch_;
+    if(search_epoch_ == std::numeric_limits<std::uint32_t>::max()) {
+        for(auto *side : {&forward_, &backward_}) {
+            std::ranges::fill(side->distance_stamps, 0);
+            std::ranges::fill(side->visited_stamps, 0);
+        }
+        search_epoch_ = 1;
+    }
+}
+
+auto DijkstraWorkspace::distance(const SearchSide &side, const common::NetworkNodeID node) const -> std::int64_t
+{
+    return side.distance_stamps[node.get()] == search_epoch_ ? side.distances[node.get()] : UNREACHED;
+}
+
+template<class Frontier>
+auto DijkstraWorkspace::bidirectionalSearch(const common::NetworkNodeID source, const common::NetworkNodeID destination,
+                                            const MultiLayeredGraph &network,
+                                            Frontier &forward_frontier, Frontier &backward_frontier)
+    -> std::optional<common::NetworkNodeID>
+{
+    forward_frontier.clear(max_weight_);
+    backward_frontier.clear(max_weight_);
+
+    forward_.distances[source.get()] = std::int64_t{0};
+    forward_.distance_stamps[source.get()] = search_epoch_;
+    forward_frontier.push(source, std::int64_t{0});
+    backward_.distances[destination.get()] = std::int64_t{0};
+    backward_.distance_stamps[destination.get()] = search_epoch_;
+    backward_frontier.push(destination, std::int64_t{0});
+
+    // length of the shortest path found so far and the node where its halves meet
+    std::int64_t best_distance = UNREACHED;
+    std::optional<common::NetworkNodeID> meeting_node;
+
+    while(not forward_frontier.empty() and not backward_frontier.empty()) {
+        const auto forward_min = forward_frontier.minDistance();
+        const auto backward_min = backward_frontier.minDistance();
+        if(forward_min + backward_min >= best_distance) {
+            // every path that is not found yet is at least as long
+            break;
+        }
+
+        // expand the direction with the smaller radius
+        const bool forward = forward_min <= backward_min;
+        auto &side = forward ? forward_ : backward_;
+        const auto &other_side = forward ? backward_ : forward_;
+        auto &frontier = forward ? forward_frontier : backward_frontier;
+
+        const auto [current_node, current_distance] = frontier.pop();
+        if(side.visited_stamps[current_node.get()] == search_epoch_ or current_distance != distance(side, current_node)) {
+            /* this filters already expanded nodes and outdated duplicates */
+            continue;
+        }
+        side.visited_stamps[current_node.get()] = search_epoch_;
+
+        const auto relax = [&](const common::NetworkQueueID link, const common::NetworkNodeID next_hop) {
+            const auto weight = getWeight(link);
+            if(weight == REMOVED) {
+                return;
+            }
+
+            const auto distance_to_next_hop = current_distance + weight;
+            if(distance_to_next_hop >= distance(side, next_hop)) {
+                return;
+            }
+            side.distances[next_hop.get()] = distance_to_next_hop;
+            side.distance_stamps[next_hop.get()] = search_epoch_;
+            side.links[next_hop.get()] = link;
+            /* update the frontier,
+             * note that this can add duplicates with lower distances
+             */
+            frontier.push(next_hop, distance_to_next_hop);
+
+            if(const auto other_distance = distance(other_side, next_hop);
+               other_distance != UNREACHED and distance_to_next_hop + other_distance < best_distance) {
+                best_distance = distance_to_next_hop + other_distance;
+                meeting_node = next_hop;
+            }
+        };
+
+        if(forward) {
+            for(const auto &out_link : network.getEgressQueuesOf(current_node)) {
+                relax(out_link.id, out_link.destination);
+            }
+        } else {
+            for(const auto in_link : network.getIngressQueuesOf(current_node)) {
+                relax(in_link, network.getSourceOf(in_link));
+            }
+        }
+    }
+
+    return meeting_node;
+}
+
+auto DijkstraWorkspace::shortestPath(const common::NetworkNodeID source, const common::NetworkNodeID destination,
+                                     const MultiLayeredGraph &network)
+    -> std::vector<common::NetworkQueueID>
+{
+    auto path = findShortestPath(source, destination, network);
+    if(not path.has_value()) {
+        throw std::runtime_error(fmt::format("node {} is not reachable from node {}", destination.get(), source.get()));
+    }
+    return std::move(path.value());
+}
+
+auto DijkstraWorkspace::findShortestPath(const common::NetworkNodeID source, const common::NetworkNodeID destination,
+                                         const MultiLayeredGraph &network)
+    -> std::optional<std::vector<common::NetworkQueueID>>
+{
+    if(source == destination) {
+        return std::vector<common::NetworkQueueID>();
+    }
+
+    prepare(network);
+
+    const auto meeting_node = max_weight_ <= MAX_BUCKET_WEIGHT
+        ? bidirectionalSearch(source, destination, network, forward_buckets_, backward_buckets_)
+        : bidirectionalSearch(source, destination, network, forward_heap_, backward_heap_);
+
+    if(not meeting_node.has_value()) {
+        return std::nullopt;
+    }
+
+    /* extract path, first the forward half backwards from the meeting node */
+    std::vector<common::NetworkQueueID> path;
+    auto current_node = meeting_node.value();
+    while(current_node != source) {
+        const auto link = forward_.links[current_node.get()];
+        path.emplace_back(link);
+        current_node = network.getSourceOf(link);
+    }
+    std::ranges::reverse(path);
+
+    /* then the backward half from the meeting node to the destination */
+    current_node = meeting_node.value();
+    while(current_node != destination) {
+        const auto link = backward_.links[current_node.get()];
+        path.emplace_back(link);
+        current_node = network.getEgressQueue(link).destination;
+    }
+
+    return path;
+}
+
+} // namespace routing
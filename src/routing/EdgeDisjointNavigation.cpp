@@ -0,0 +1,278 @@
+#include "routing/EdgeDisjointNavigation.h"
+#include "util/UtilFunctions.h"
+#include "util/robin_hood.h"
+#include <algorithm>
+#include <fmt/core.h>
+#include <limits>
+#include <stdexcept>
+
+namespace routing {
+
+auto EdgeDisjointNavigation::name() -> std::string
+{
+    return "EdgeDisjoint";
+}
+
+auto EdgeDisjointNavigation::findRoutes(const common::NetworkNodeID source, const common::NetworkNodeID destination,
+                                        const MultiLayeredGraph &network,
+                                        const std::size_t number_of_candidates)
+    -> std::vector<std::vector<common::NetworkQueueID>>
+{
+    if(source == destination) {
+        return {{}};
+    }
+
+    // exceeds the length of every simple path, thus a detour is always cheaper than sharing a queue
+    const auto overlap_penalty = static_cast<std::int64_t>(network.getNumberOfNetworkNodes());
+
+    // one workspace per thread, so that consecutive flows don't allocate the search state again
+    thread_local Workspace workspace;
+    workspace.resetFlow(network);
+
+    // min-cost flow, one unit per candidate
+    for(std::size_t unit = 0; unit < number_of_candidates; ++unit) {
+        workspace.routeUnit(source, destination, network, overlap_penalty);
+    }
+    auto candidate_paths = decomposeFlow(source, destination, network, workspace);
+
+    // without enough disjoint paths, a unit might repeat a path. Further units are routed until the paths are distinct
+    for(auto additional_units = 0; candidate_paths.size() < number_of_candidates and additional_units < DUPLICATE_PATH_LIMIT; ++additional_units) {
+        workspace.routeUnit(source, destination, network, overlap_penalty);
+        candidate_paths = decomposeFlow(source, destination, network, workspace);
+    }
+
+    std::ranges::stable_sort(candidate_paths, std::less(), [](const auto &path) { return path.size(); });
+    if(candidate_paths.size() > number_of_candidates) {
+        candidate_paths.resize(number_of_candidates);
+    }
+    return candidate_paths;
+}
+
+auto EdgeDisjointNavigation::unitCost(const std::int64_t units, const std::int64_t overlap_penalty) -> std::int64_t
+{
+    return 1 + overlap_penalty * units;
+}
+
+auto EdgeDisjointNavigation::decomposeFlow(const common::NetworkNodeID source, const common::NetworkNodeID destination,
+                                           const MultiLayeredGraph &network,
+                                           const Workspace &workspace)
+    -> std::vector<std::vector<common::NetworkQueueID>>
+{
+    // every unit has a positive cost, thus the flow has no cycles and each walk along the units reaches the destination
+    std::vector<std::vector<common::NetworkQueueID>> paths;
+    robin_hood::unordered_map<common::NetworkQueueID, std::int64_t> used_units;
+    const auto has_units = [&](const auto &egress_queue) {
+        const auto iter = used_units.find(egress_queue.id);
+        return workspace.getUnits(egress_queue.id) > (iter == used_units.end() ? 0 : iter->second);
+    };
+
+    while(std::ranges::any_of(network.getEgressQueuesOf(source), has_units)) {
+        std::vector<common::NetworkQueueID> path;
+        for(auto node = source; node != destination;) {
+            const auto &next_hop = *std::ranges::find_if(network.getEgressQueuesOf(node), has_units);
+            ++used_units[next_hop.id];
+            path.emplace_back(next_hop.id);
+            node = next_hop.destination;
+        }
+
+        if(not util::vector_contains(paths, path)) {
+            paths.emplace_back(std::move(path));
+        }
+    }
+    return paths;
+}
+
+auto EdgeDisjointNavigation::Workspace::resetFlow(const MultiLayeredGraph &network) -> void
+{
+    const auto number_of_nodes = network.getNumberOfNetworkNodes();
+    if(potentials_.size() < number_of_nodes) {
+        potentials_.resize(number_of_nodes);
+        potential_stamps_.resize(number_of_nodes, 0);
+        for(auto& side : sides_) {
+            side.distances.resize(number_of_nodes);
+            side.links.resize(number_of_nodes, ResidualLink{.queue = common::NetworkQueueID{0}, .forward = true});
+            side.distance_stamps.resize(number_of_nodes, 0);
+            side.settled_stamps.resize(number_of_nodes, 0);
+        }
+    }
+    if(units_.size() < network.getNumberOfEgressQueues()) {
+        units_.resize(network.getNumberOfEgressQueues());
+        unit_stamps_.resize(network.getNumberOfEgressQueues(), 0);
+    }
+
+    ++flow_epoch_;
+    if(flow_epoch_ == std::numeric_limits<std::uint32_t>::max()) {
+        std::ranges::fill(unit_stamps_, 0);
+        std::ranges::fill(potential_stamps_, 0);
+        flow_epoch_ = 1;
+    }
+}
+
+auto EdgeDisjointNavigation::Workspace::getUnits(const common::NetworkQueueID queue_id) const -> std::int64_t
+{
+    return unit_stamps_[queue_id.get()] == flow_epoch_ ? units_[queue_id.get()] : 0;
+}
+
+auto EdgeDisjointNavigation::Workspace::addUnits(const common::NetworkQueueID queue_id, const std::int64_t units) -> void
+{
+    units_[queue_id.get()] = getUnits(queue_id) + units;
+    unit_stamps_[queue_id.get()] = flow_epoch_;
+}
+
+auto EdgeDisjointNavigation::Workspace::getPotential(const common::UnderlyingID node) const -> std::int64_t
+{
+    return potential_stamps_[node] == flow_epoch_ ? potentials_[node] : 0;
+}
+
+auto EdgeDisjointNavigation::Workspace::routeUnit(const common::NetworkNodeID source, const common::NetworkNodeID destination,
+                                                  const MultiLayeredGraph &network,
+                                                  const std::int64_t overlap_penalty) -> void
+{
+    if(not search(source, destination, network, overlap_penalty)) {
+        throw std::runtime_error(fmt::format("node {} is not reachable from node {}", destination.get(), source.get()));
+    }
+
+    for(auto node = meeting_node_; node != source.get();) {
+        const auto link = sides_[FORWARD].links[node];
+        if(link.forward) {
+            addUnits(link.queue, 1);
+            node = network.getSourceOf(link.queue).get();
+        } else {
+            addUnits(link.queue, -1);
+            node = network.getEgressQueue(link.queue).destination.get();
+        }
+    }
+    for(auto node = meeting_node_; node != destination.get();) {
+        const auto link = sides_[BACKWARD].links[node];
+        if(link.forward) {
+            addUnits(link.queue, 1);
+            node = network.getEgressQueue(link.queue).destination.get();
+        } else {
+            addUnits(link.queue, -1);
+            node = network.getSourceOf(link.queue).get();
+        }
+    }
+}
+
+auto EdgeDisjointNavigation::Workspace::search(const common::NetworkNodeID source, const common::NetworkNodeID destination,
+                                               const MultiLayeredGraph &network,
+                                               const std::int64_t overlap_penalty) -> bool
+{
+    ++search_epoch_;
+    if(search_epoch_ == std::numeric_limits<std::uint32_t>::max()) {
+        for(auto& side : sides_) {
+            std::ranges::fill(side.distance_stamps, 0);
+            std::ranges::fill(side.settled_stamps, 0);
+        }
+        search_epoch_ = 1;
+    }
+    for(auto& side : sides_) {
+        side.settled_nodes.clear();
+        side.heap.clear();
+    }
+
+    // length of the shortest path found so far, joined at meeting_node_
+    constexpr auto UNREACHED = std::numeric_limits<std::int64_t>::max();
+    auto shortest_distance = UNREACHED;
+    const auto relax = [&](const std::size_t direction, const common::UnderlyingID node, const std::int64_t distance, const ResidualLink link) {
+        auto& side = sides_[direction];
+        if(side.distance_stamps[node] == search_epoch_ and side.distances[node] <= distance) {
+            return;
+        }
+        side.distances[node] = distance;
+        side.distance_stamps[node] = search_epoch_;
+        side.links[node] = link;
+        side.heap.emplace_back(distance, node);
+        std::ranges::push_heap(side.heap, std::greater());
+
+        const auto& other_side = sides_[1 - direction];
+        if(other_side.distance_stamps[node] == search_epoch_ and distance + other_side.distances[node] < shortest_distance) {
+            shortest_distance = distance + other_side.distances[node];
+            meeting_node_ = node;
+        }
+    };
+    // reduced cost of the residual link from -> to, non-negative due to the potentials
+    const auto reduced_cost = [&](const common::UnderlyingID from, const common::UnderlyingID to, const std::int64_t cost) {
+        return cost + getPotential(from) - getPotential(to);
+    };
+    // lower bound of the distances of the nodes that are not settled yet
+    const auto radius = [&](const std::size_t direction) {
+        return sides_[direction].heap.empty() ? UNREACHED : sides_[direction].heap.front().first;
+    };
+
+    relax(FORWARD, source.get(), 0, ResidualLink{.queue = common::NetworkQueueID{0}, .forward = true});
+    relax(BACKWARD, destination.get(), 0, ResidualLink{.queue = common::NetworkQueueID{0}, .forward = true});
+    while(not sides_[FORWARD].heap.empty() and not sides_[BACKWARD].heap.empty()
+          and radius(FORWARD) + radius(BACKWARD) < shortest_distance) {
+        // expand the side with less candidates
+        const auto direction = sides_[FORWARD].heap.size() <= sides_[BACKWARD].heap.size() ? FORWARD : BACKWARD;
+        auto& side = sides_[direction];
+        std::ranges::pop_heap(side.heap, std::greater());
+        const auto [distance, node] = side.heap.back();
+        side.heap.pop_back();
+        if(side.settled_stamps[node] == search_epoch_) {
+            continue;
+        }
+        side.settled_stamps[node] = search_epoch_;
+        side.settled_nodes.emplace_back(node);
+
+        const common::NetworkNodeID node_id{node};
+        if(direction == FORWARD) {
+            for(const auto &egress_queue : network.getEgressQueuesOf(node_id)) {
+                const auto next = egress_queue.destination.get();
+                relax(FORWARD, next, distance + reduced_cost(node, next, unitCost(getUnits(egress_queue.id), overlap_penalty)),
+                      ResidualLink{.queue = egress_queue.id, .forward = true});
+            }
+            // cancelling a unit returns the cost of its last unit
+            for(const auto ingress_queue : network.getIngressQueuesOf(node_id)) {
+                if(const auto units = getUnits(ingress_queue); units > 0) {
+                    const auto next = network.getSourceOf(ingress_queue).get();
+                    relax(FORWARD, next, distance + reduced_cost(node, next, -unitCost(units - 1, overlap_penalty)),
+                          ResidualLink{.queue = ingress_queue, .forward = false});
+                }
+            }
+        } else {
+            // the same residual links, traversed from their end
+            for(const auto ingress_queue : network.getIngressQueuesOf(node_id)) {
+                const auto previous = network.getSourceOf(ingress_queue).get();
+                relax(BACKWARD, previous, distance + reduced_cost(previous, node, unitCost(getUnits(ingress_queue), overlap_penalty)),
+                      ResidualLink{.queue = ingress_queue, .forward = true});
+            }
+            for(const auto &egress_queue : network.getEgressQueuesOf(node_id)) {
+                if(const auto units = getUnits(egress_queue.id); units > 0) {
+                    const auto previous = egress_queue.destination.get();
+                    relax(BACKWARD, previous, distance + reduced_cost(previous, node, -unitCost(units - 1, overlap_penalty)),
+                          ResidualLink{.queue = egress_queue.id, .forward = false});
+                }
+            }
+        }
+    }
+
+    if(shortest_distance == UNREACHED) {
+        return false;
+    }
+
+    /*
+     * With the shortest distance d and a split value a, such that all nodes with a forward distance below a and all
+     * nodes with a backward distance below d - a are settled, the potentials
+     *   min(forward distance, a) + max(d - backward distance, a)
+     * keep all reduced costs non-negative and are tight along the shortest path. Only the differences of the potentials
+     * matter, thus a is subtracted twice and the nodes that were not settled keep their potential.
+     */
+    const auto split = std::min(radius(FORWARD), shortest_distance);
+    for(const auto node : sides_[FORWARD].settled_nodes) {
+        if(const auto distance = sides_[FORWARD].distances[node]; distance < split) {
+            potentials_[node] = getPotential(node) + distance - split;
+            potential_stamps_[node] = flow_epoch_;
+        }
+    }
+    for(const auto node : sides_[BACKWARD].settled_nodes) {
+        if(const auto distance = shortest_distance - sides_[BACKWARD].distances[node]; distance > split) {
+            potentials_[node] = getPotential(node) + distance - split;
+            potential_stamps_[node] = flow_epoch_;
+        }
+    }
+    return true;
+}
+
+} // namespace routing
@@ -1,101 +1,186 @@
 #include <routing/KShortest.h>
-#include <routing/RoutingUtil.h>
-#include <util/UtilFunctions.h>
 
 std::string routing::KShortest::name()
 {
     return "kShortest";
 }
 
-auto routing::KShortest::findRoutes(const common::NetworkNodeID source,
-                                    const common::NetworkNodeID destination,
-                                    const MultiLayeredGraph& network,
-                                    const std::size_t number_of_candidates)
-    -> std::vector<std::vector<common::NetworkQueueID>>
+class routing::KShortest::Generator final : public RouteGenerator
 {
-    WeightMap weight_map;
-    std::vector<std::vector<common::NetworkQueueID>> A;
-    A.emplace_back(getDijkstraShortestPath(source, destination, network, weight_map));
-
-    std::vector<std::vector<common::NetworkQueueID>> B;
-
-    for(std::size_t k = 1; k < number_of_candidates; ++k) {
-        common::NetworkNodeID spurNode = source;
-        auto& previous_route = A[k - 1];
-        int i = 0;
-        for(const auto& hop_id : previous_route) {
-            const auto& hop = network.getEgressQueue(hop_id);
-            // Spur node is retrieved from the previous k-shortest path, k − 1.
-            // handled partly outside the loop
-            // The sequence of nodes from the source to the spur node of the previous k-shortest path.
-            std::vector rootPath(previous_route.begin(), previous_route.begin() + i);
-
-            for(auto& r : A) {
-                // Remove the links that are part of the previous shortest paths which share the same root path.
-                const auto end_index = std::min(r.size(), rootPath.size());
-                for(std::size_t compare_index = 0; compare_index < end_index; ++compare_index) {
-                    if(r[compare_index].get() != rootPath[compare_index].get()) {
-                        // continue outer loop
-                        goto paths_not_equal_skip;
-                    }
-                }
-                // subpart of route in A and rootPath are equal
-                weight_map[r.at(end_index)] = LARGE_NUMBER;
-            paths_not_equal_skip:;
+public:
+    Generator(const common::NetworkNodeID source, const common::NetworkNodeID destination)
+        : source_(source),
+          destination_(destination)
+    {}
+
+    auto next(const MultiLayeredGraph& network) -> std::optional<std::vector<common::NetworkQueueID>> override
+    {
+        // one workspace per thread, so that consecutive flows don't allocate the search state again
+        thread_local DijkstraWorkspace workspace;
+        workspace.resetWeights();
+
+        if(prefix_tree_.empty()) {
+            previous_route_ = workspace.shortestPath(source_, destination_, network);
+            previous_deviation_index_ = 0;
+            // the paths found so far as prefix tree, node 0 is the source
+            prefix_tree_.resize(1);
+            insertIntoPrefixTree(prefix_tree_, previous_route_);
+            known_paths_.insert(previous_route_);
+            return previous_route_;
+        }
+
+        /*
+         * The root path grows by one hop per spur node and its nodes must not be used by the spur path.
+         * Thus the removed edges only grow while iterating the spur nodes and the weights are reset once per path.
+         */
+        common::NetworkNodeID spur_node = source_;
+        std::size_t tree_node = 0;
+        for(std::size_t i = 0; i < previous_route_.size(); ++i) {
+            if(i < previous_deviation_index_) {
+                /*
+                 * Lawler's modification: before its deviation, the previous route equals the path it was derived from.
+                 * Thus these spur nodes were already examined and only the root path has to be removed.
+                 */
+                effectivelyRemoveNode(spur_node, network, workspace);
+                spur_node = network.getEgressQueue(previous_route_[i]).destination;
+                tree_node = findChildInPrefixTree(prefix_tree_, tree_node, previous_route_[i]);
+                continue;
             }
 
-            // this shift ensures we don't remove the last destination, e.g., the starting node of the spur path
-            common::NetworkNodeID previous = source;
-            for(const auto& root_path_hop_id : rootPath) {
-                effectivelyRemoveNode(previous, network, weight_map);
-                previous = network.getEgressQueue(root_path_hop_id).destination;
+            // Remove the links that are part of the previous shortest paths which share the same root path.
+            // These are exactly the children of the root path in the prefix tree.
+            for(const auto& [queue_id, child] : prefix_tree_[tree_node].children) {
+                workspace.removeEdge(queue_id);
             }
 
             // Calculate the spur path from the spur node to the sink.
-            // Consider also checking if any spurPath found
-            auto spurPath = getDijkstraShortestPath(spurNode, destination, network, weight_map);
-            // filter illegal paths (those using deleted edges)
-            const bool valid = not std::ranges::any_of(spurPath, [&](auto& current_hop) {
-                return weight_map.contains(current_hop);
-            });
-
-            // Entire path is made up of the root path and spur path.
-            rootPath.insert(rootPath.end(), spurPath.begin(), spurPath.end());
-            // Add the potential k-shortest path to the heap.
-            if(valid and not util::vector_contains(B, rootPath)) {
-                B.emplace_back(std::move(rootPath)); // now total path
+            // there is none if the removed edges disconnect the spur node from the sink
+            if(auto spur_path = workspace.findShortestPath(spur_node, destination_, network);
+               spur_path.has_value()) {
+                // Entire path is made up of the root path and spur path.
+                std::vector<common::NetworkQueueID> total_path;
+                total_path.reserve(i + spur_path->size());
+                total_path.insert(total_path.end(), previous_route_.begin(), previous_route_.begin() + static_cast<std::ptrdiff_t>(i));
+                total_path.insert(total_path.end(), spur_path->begin(), spur_path->end());
+
+                // Add the potential k-shortest path to the heap.
+                if(known_paths_.insert(total_path).second) {
+                    candidates_.emplace_back(Candidate{.path = std::move(total_path), .deviation_index = i, .sequence_number = number_of_inserted_candidates_++});
+                    std::ranges::push_heap(candidates_, std::greater(), candidateOrder);
+                }
             }
 
-            // Add back the edges and nodes that were removed from the graph.
-            weight_map.clear();
-            spurNode = hop.destination;
-            ++i;
+            // the spur node becomes part of the root path
+            effectivelyRemoveNode(spur_node, network, workspace);
+            spur_node = network.getEgressQueue(previous_route_[i]).destination;
+            tree_node = findChildInPrefixTree(prefix_tree_, tree_node, previous_route_[i]);
         }
-        if(B.empty()) {
+        // the spur nodes of the previous route are examined, a further call must not examine them again
+        previous_deviation_index_ = previous_route_.size();
+
+        if(candidates_.empty()) {
             // This handles the case of there being no spur paths, or no spur paths left.
             // This could happen if the spur paths have already been exhausted (added to A),
             // or there are no spur paths at all - such as when both the source and sink vertices
             // lie along a "dead end".
-            break;
+            return std::nullopt;
         }
 
-        // Sort the potential k-shortest paths by cost.
-        std::ranges::sort(B, [](const auto& lhs, const auto& rhs) { return lhs.size() < rhs.size(); });
-
         // Add the lowest cost path becomes the k-shortest path.
-        A.emplace_back(std::move(B.front()));
-        B.erase(B.begin());
+        std::ranges::pop_heap(candidates_, std::greater(), candidateOrder);
+        previous_route_ = std::move(candidates_.back().path);
+        previous_deviation_index_ = candidates_.back().deviation_index;
+        candidates_.pop_back();
+        insertIntoPrefixTree(prefix_tree_, previous_route_);
+        return previous_route_;
+    }
+
+private:
+    static auto candidateOrder(const Candidate& candidate) -> std::pair<std::size_t, std::size_t>
+    {
+        return std::pair(candidate.path.size(), candidate.sequence_number);
     }
 
+    common::NetworkNodeID source_;
+    common::NetworkNodeID destination_;
 
+    // the last path found and the index of the spur node it was found at
+    std::vector<common::NetworkQueueID> previous_route_;
+    std::size_t previous_deviation_index_ = 0;
+
+    std::vector<PrefixTreeNode> prefix_tree_;
+
+    // min-heap of the potential k-shortest paths, ordered by length and insertion order
+    std::vector<Candidate> candidates_;
+    std::size_t number_of_inserted_candidates_ = 0;
+
+    // all paths that were ever found or added to B
+    robin_hood::unordered_set<std::vector<common::NetworkQueueID>, PathHash> known_paths_;
+};
+
+auto routing::KShortest::findRoutes(const common::NetworkNodeID source,
+                                    const common::NetworkNodeID destination,
+                                    const MultiLayeredGraph& network,
+                                    const std::size_t number_of_candidates)
+    -> std::vector<std::vector<common::NetworkQueueID>>
+{
+    std::vector<std::vector<common::NetworkQueueID>> A;
+    Generator generator(source, destination);
+    while(A.size() < number_of_candidates) {
+        auto path = generator.next(network);
+        if(not path.has_value()) {
+            break;
+        }
+        A.emplace_back(std::move(path.value()));
+    }
     return A;
 }
 
+auto routing::KShortest::createRouteGenerator(const common::NetworkNodeID source, const common::NetworkNodeID destination)
+    -> std::unique_ptr<RouteGenerator>
+{
+    return std::make_unique<Generator>(source, destination);
+}
+
 auto routing::KShortest::effectivelyRemoveNode(const common::NetworkNodeID node,
                                                const MultiLayeredGraph& graph,
-                                               WeightMap& weightMap) const -> void
+                                               DijkstraWorkspace& workspace) -> void
 {
     for(auto& out_link : graph.getEgressQueuesOf(node)) {
-        weightMap[out_link.id] = LARGE_NUMBER;
+        workspace.removeEdge(out_link.id);
+    }
+}
+
+auto routing::KShortest::insertIntoPrefixTree(std::vector<PrefixTreeNode>& prefix_tree,
+                                              const std::vector<common::NetworkQueueID>& path) -> void
+{
+    std::size_t tree_node = 0;
+    for(const auto hop : path) {
+        auto child = findChildInPrefixTree(prefix_tree, tree_node, hop);
+        if(child == 0) {
+            child = prefix_tree.size();
+            prefix_tree[tree_node].children.emplace_back(hop, child);
+            prefix_tree.emplace_back();
+        }
+        tree_node = child;
+    }
+}
+
+auto routing::KShortest::findChildInPrefixTree(const std::vector<PrefixTreeNode>& prefix_tree,
+                                               const std::size_t tree_node,
+                                               const common::NetworkQueueID hop) -> std::size_t
+{
+    // few children per node, a linear search is the fastest
+    const auto& children = prefix_tree[tree_node].children;
+    const auto iter = std::ranges::find(children, hop, &std::pair<common::NetworkQueueID, std::size_t>::first);
+    return iter == children.end() ? 0 : iter->second;
+}
+
+auto routing::KShortest::PathHash::operator()(const std::vector<common::NetworkQueueID>& path) const noexcept -> std::size_t
+{
+    auto seed = robin_hood::hash_int(path.size());
+    for(const auto hop : path) {
+        seed ^= robin_hood::hash_int(hop.get()) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
     }
+    return seed;
 }
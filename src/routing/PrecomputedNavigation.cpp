@@ -0,0 +1,310 @@
+#include "routing/PrecomputedNavigation.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <fcntl.h>
+#include <fstream>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
+
+namespace routing {
+
+PrecomputedNavigation::PrecomputedNavigation(std::shared_ptr<AbstractNavigation> navigator)
+    : navigator_(std::move(navigator))
+{}
+
+auto PrecomputedNavigation::precompute(std::shared_ptr<AbstractNavigation> navigator,
+                                       const MultiLayeredGraph &network,
+                                       const std::size_t number_of_candidates,
+                                       const std::size_t number_of_threads)
+    -> PrecomputedNavigation
+{
+    PrecomputedNavigation table(std::move(navigator));
+    table.number_of_queues_ = network.getNumberOfEgressQueues();
+    table.topology_hash_ = hashTopology(network);
+    table.navigator_hash_ = hashName(table.navigator_->name());
+    table.number_of_candidates_ = number_of_candidates;
+
+    for(common::UnderlyingID node = 0; node < network.getNumberOfNetworkNodes(); ++node) {
+        const auto egress_queues = network.getEgressQueuesOf(common::NetworkNodeID{node});
+        if(not egress_queues.empty() and egress_queues.front().end_device) {
+            table.owned_devices_.emplace_back(node);
+        }
+    }
+    const auto number_of_devices = table.owned_devices_.size();
+
+    // routes per source device, merged in device order afterwards, thus the table does not depend on the threads
+    struct SourceRoutes
+    {
+        std::vector<std::uint64_t> routes_per_destination;
+        std::vector<std::uint64_t> hops_per_route;
+        std::vector<common::UnderlyingID> hops;
+    };
+    std::vector<SourceRoutes> routes_per_source(number_of_devices);
+
+    const auto route_source = [&](const std::size_t source_index) {
+        auto &source_routes = routes_per_source[source_index];
+        source_routes.routes_per_destination.reserve(number_of_devices);
+        for(const auto destination : table.owned_devices_) {
+            // an unreachable pair is stored without routes, thus only a flow between them fails when the decorated
+            // navigator is asked again, instead of an exception escaping the worker
+            std::vector<std::vector<common::NetworkQueueID>> routes;
+            try {
+                routes = table.navigator_->findRoutes(common::NetworkNodeID{table.owned_devices_[source_index]},
+                                                      common::NetworkNodeID{destination},
+                                                      network,
+                                                      number_of_candidates);
+            } catch(const std::runtime_error &) {
+            }
+            source_routes.routes_per_destination.emplace_back(routes.size());
+            for(const auto &route : routes) {
+                source_routes.hops_per_route.emplace_back(route.size());
+                std::ranges::transform(route, std::back_inserter(source_routes.hops), [](const auto hop) { return hop.get(); });
+            }
+        }
+    };
+
+    std::atomic<std::size_t> next_index{0};
+    {
+        std::vector<std::jthread> workers;
+        const auto number_of_workers = std::max(std::min(number_of_threads, number_of_devices), std::size_t{1});
+        workers.reserve(number_of_workers);
+        for(auto i = std::size_t{0}; i < number_of_workers; ++i) {
+            workers.emplace_back([&] {
+                for(auto index = next_index++; index < number_of_devices; index = next_index++) {
+                    route_source(index);
+                }
+            });
+        }
+    }
+
+    // merge
+    table.owned_pair_offsets_.reserve(number_of_devices * number_of_devices + 1);
+    table.owned_pair_offsets_.emplace_back(0);
+    table.owned_route_offsets_.emplace_back(0);
+    for(auto &source_routes : routes_per_source) {
+        for(const auto number_of_routes : source_routes.routes_per_destination) {
+            table.owned_pair_offsets_.emplace_back(table.owned_pair_offsets_.back() + number_of_routes);
+        }
+        for(const auto number_of_hops : source_routes.hops_per_route) {
+            table.owned_route_offsets_.emplace_back(table.owned_route_offsets_.back() + number_of_hops);
+        }
+        table.owned_hops_.insert(table.owned_hops_.end(), source_routes.hops.begin(), source_routes.hops.end());
+        source_routes = SourceRoutes();
+    }
+
+    table.devices_ = table.owned_devices_;
+    table.pair_offsets_ = table.owned_pair_offsets_;
+    table.route_offsets_ = table.owned_route_offsets_;
+    table.hops_ = table.owned_hops_;
+    table.indexEndDevices(network);
+    return table;
+}
+
+auto PrecomputedNavigation::load(const std::string &path,
+                                 std::shared_ptr<AbstractNavigation> navigator,
+                                 const MultiLayeredGraph &network,
+                                 const std::size_t number_of_candidates)
+    -> std::optional<PrecomputedNavigation>
+{
+    const auto file_descriptor = ::open(path.c_str(), O_RDONLY);
+    if(file_descriptor < 0) {
+        return std::nullopt;
+    }
+    struct stat file_status
+    {};
+    if(::fstat(file_descriptor, &file_status) != 0
+       or static_cast<std::size_t>(file_status.st_size) < HEADER_FIELDS * sizeof(std::uint64_t)) {
+        ::close(file_descriptor);
+        return std::nullopt;
+    }
+    const auto file_size = static_cast<std::size_t>(file_status.st_size);
+    auto *const address = ::mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+    // the mapping stays valid after closing the file
+    ::close(file_descriptor);
+    if(address == MAP_FAILED) {
+        return std::nullopt;
+    }
+
+    PrecomputedNavigation table(std::move(navigator));
+    table.mapping_ = std::shared_ptr<const std::byte>(static_cast<const std::byte *>(address), [file_size](const std::byte *mapped) {
+        ::munmap(const_cast<std::byte *>(mapped), file_size);
+    });
+
+    const std::span header(static_cast<const std::uint64_t *>(address), HEADER_FIELDS);
+    const auto number_of_devices = header[7];
+    const auto number_of_routes = header[8];
+    const auto number_of_hops = header[9];
+    if(header[0] != MAGIC
+       or header[1] != sizeof(common::UnderlyingID)
+       or header[2] != network.getNumberOfNetworkNodes()
+       or header[3] != network.getNumberOfEgressQueues()
+       or header[4] != hashTopology(network)
+       or header[5] != hashName(table.navigator_->name())
+       or header[6] != number_of_candidates) {
+        return std::nullopt;
+    }
+
+    // bounds the counts, so that the expected size can not overflow
+    if(number_of_devices > network.getNumberOfNetworkNodes() or number_of_routes > file_size or number_of_hops > file_size) {
+        return std::nullopt;
+    }
+    const auto devices_size = (number_of_devices * sizeof(common::UnderlyingID) + 7) / 8 * 8;
+    const auto expected_size = HEADER_FIELDS * sizeof(std::uint64_t)
+        + devices_size
+        + (number_of_devices * number_of_devices + 1) * sizeof(std::uint64_t)
+        + (number_of_routes + 1) * sizeof(std::uint64_t)
+        + number_of_hops * sizeof(common::UnderlyingID);
+    if(file_size != expected_size) {
+        return std::nullopt;
+    }
+
+    const auto *position = static_cast<const std::byte *>(address) + HEADER_FIELDS * sizeof(std::uint64_t);
+    table.devices_ = {reinterpret_cast<const common::UnderlyingID *>(position), number_of_devices};
+    position += devices_size;
+    table.pair_offsets_ = {reinterpret_cast<const std::uint64_t *>(position), number_of_devices * number_of_devices + 1};
+    position += table.pair_offsets_.size_bytes();
+    table.route_offsets_ = {reinterpret_cast<const std::uint64_t *>(position), number_of_routes + 1};
+    position += table.route_offsets_.size_bytes();
+    table.hops_ = {reinterpret_cast<const common::UnderlyingID *>(position), number_of_hops};
+
+    if(std::ranges::any_of(table.devices_, [&](const auto device) { return device >= network.getNumberOfNetworkNodes(); })
+       or not table.hasValidOffsets(network.getNumberOfEgressQueues())) {
+        return std::nullopt;
+    }
+
+    table.number_of_queues_ = network.getNumberOfEgressQueues();
+    table.topology_hash_ = header[4];
+    table.navigator_hash_ = header[5];
+    table.number_of_candidates_ = number_of_candidates;
+    table.indexEndDevices(network);
+    return table;
+}
+
+auto PrecomputedNavigation::save(const std::string &path) const -> bool
+{
+    std::ofstream output_file(path, std::ios::binary | std::ios::trunc);
+    if(not output_file) {
+        return false;
+    }
+
+    const auto write = [&](const auto values) {
+        output_file.write(reinterpret_cast<const char *>(values.data()), static_cast<std::streamsize>(values.size_bytes()));
+    };
+
+    const std::array<std::uint64_t, HEADER_FIELDS> header{MAGIC,
+                                                          sizeof(common::UnderlyingID),
+                                                          device_index_.size(),
+                                                          number_of_queues_,
+                                                          topology_hash_,
+                                                          navigator_hash_,
+                                                          number_of_candidates_,
+                                                          devices_.size(),
+                                                          route_offsets_.size() - 1,
+                                                          hops_.size()};
+    write(std::span(header));
+    write(devices_);
+    const std::array<std::byte, 8> padding{};
+    write(std::span(padding).first((8 - devices_.size_bytes() % 8) % 8));
+    write(pair_offsets_);
+    write(route_offsets_);
+    write(hops_);
+
+    return static_cast<bool>(output_file.flush());
+}
+
+auto PrecomputedNavigation::name() -> std::string
+{
+    return navigator_->name();
+}
+
+auto PrecomputedNavigation::findRoutes(const common::NetworkNodeID source, const common::NetworkNodeID destination,
+                                       const MultiLayeredGraph &network,
+                                       const std::size_t number_of_candidates)
+    -> std::vector<std::vector<common::NetworkQueueID>>
+{
+    const auto source_index = device_index_[source.get()];
+    const auto destination_index = device_index_[destination.get()];
+    if(number_of_candidates != number_of_candidates_ or source_index == NO_END_DEVICE or destination_index == NO_END_DEVICE) {
+        return navigator_->findRoutes(source, destination, network, number_of_candidates);
+    }
+
+    const auto pair_index = source_index * devices_.size() + destination_index;
+    if(pair_offsets_[pair_index] == pair_offsets_[pair_index + 1]) {
+        // no routes were found during the precomputation
+        return navigator_->findRoutes(source, destination, network, number_of_candidates);
+    }
+    std::vector<std::vector<common::NetworkQueueID>> routes;
+    routes.reserve(pair_offsets_[pair_index + 1] - pair_offsets_[pair_index]);
+    for(auto route_index = pair_offsets_[pair_index]; route_index < pair_offsets_[pair_index + 1]; ++route_index) {
+        const auto hops = hops_.subspan(route_offsets_[route_index], route_offsets_[route_index + 1] - route_offsets_[route_index]);
+        auto &route = routes.emplace_back();
+        route.reserve(hops.size());
+        std::ranges::transform(hops, std::back_inserter(route), [](const auto hop) { return common::NetworkQueueID{hop}; });
+    }
+    return routes;
+}
+
+auto PrecomputedNavigation::createRouteGenerator(const common::NetworkNodeID source, const common::NetworkNodeID destination)
+    -> std::unique_ptr<RouteGenerator>
+{
+    return navigator_->createRouteGenerator(source, destination);
+}
+
+auto PrecomputedNavigation::getNumberOfEndDevices() const -> std::size_t
+{
+    return devices_.size();
+}
+
+auto PrecomputedNavigation::hashTopology(const MultiLayeredGraph &network) -> std::uint64_t
+{
+    // FNV-1a over all egress queues, independent of the size of the id types
+    std::uint64_t hash = 0xcbf29ce484222325;
+    const auto combine = [&](const std::uint64_t value) {
+        hash ^= value;
+        hash *= 0x100000001b3;
+    };
+    for(common::UnderlyingID node = 0; node < network.getNumberOfNetworkNodes(); ++node) {
+        for(const auto &egress_queue : network.getEgressQueuesOf(common::NetworkNodeID{node})) {
+            combine(node);
+            combine(egress_queue.id.get());
+            combine(egress_queue.destination.get());
+        }
+    }
+    return hash;
+}
+
+auto PrecomputedNavigation::hashName(const std::string &navigator_name) -> std::uint64_t
+{
+    // FNV-1a
+    std::uint64_t hash = 0xcbf29ce484222325;
+    for(const auto character : navigator_name) {
+        hash ^= static_cast<unsigned char>(character);
+        hash *= 0x100000001b3;
+    }
+    return hash;
+}
+
+auto PrecomputedNavigation::hasValidOffsets(const std::size_t number_of_queues) const -> bool
+{
+    const auto number_of_routes = route_offsets_.size() - 1;
+    const auto increasing_within = [](const std::span<const std::uint64_t> offsets, const std::uint64_t end) {
+        return offsets.front() == 0 and offsets.back() == end and std::ranges::is_sorted(offsets);
+    };
+    return increasing_within(pair_offsets_, number_of_routes)
+        and increasing_within(route_offsets_, hops_.size())
+        and std::ranges::all_of(hops_, [&](const auto hop) { return hop < number_of_queues; });
+}
+
+auto PrecomputedNavigation::indexEndDevices(const MultiLayeredGraph &network) -> void
+{
+    device_index_.assign(network.getNumberOfNetworkNodes(), NO_END_DEVICE);
+    for(std::size_t index = 0; index < devices_.size(); ++index) {
+        device_index_[devices_[index]] = index;
+    }
+}
+
+} // namespace routing
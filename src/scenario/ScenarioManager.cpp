@@ -5,6 +5,8 @@
 #include <IO/OutputLogger.h>
 #include <graph/GraphStructOperations.h>
 #include <util/Timer.h>
+#include <atomic>
+#include <thread>
 
 auto ScenarioManager::runScenario(const ProgramOptions& options,
                                   MultiLayeredGraph& graph,
@@ -32,17 +34,91 @@ auto ScenarioManager::runScenario(const ProgramOptions& options,
     const auto sub_cycle = util::calculate_gcd_period(scenario); // util::calculate_min_period(scenario);
 
     currently_active_utilization_ = common::NetworkUtilizationList(graph.getNumberOfEgressQueues(), hyper_cycle, sub_cycle);
+    // separate instance, so offensive planning can run concurrently to defensive planning
+    auto offensive_solver = solver->clone();
+    const auto step_budget = std::chrono::milliseconds{options.getStepBudget()};
     for(auto& time_step : scenario) {
-        auto [req_f, pre_configuration_time] = handleFlowChanges(graph, time_step, navigator, options.getCandidatePaths());
+        auto [req_f, pre_configuration_time] = handleFlowChanges(graph, time_step, navigator, options.getCandidatePaths(), options.getNumberOfThreads(),
+                                                                 options.isLazyCandidatePaths());
+
+        // the schedulers get a reference, the graph is not copied
+        solver->initialize(std::cref(graph));
+
+        // offensive planning
+        // ==================
+        // the result is only used if defensive planning can not schedule all flows
+        solver::solutionSet offensive_solution_set;
+        common::NetworkUtilizationList offensive_utilization(graph.getNumberOfEgressQueues(), hyper_cycle, sub_cycle);
+        auto offensive_solve_time = 0.;
+        std::jthread offensive_planning;
+        auto offensive_planning_started = false;
+        const auto start_offensive_planning = [&, &req_f = req_f] {
+            offensive_planning_started = true;
+            offensive_solver->initialize(std::cref(graph));
+            offensive_planning = std::jthread([&](const std::stop_token& stop_token) {
+                const auto offensive_solving_timer = Timer();
+                offensive_solution_set = offensive_solver->solve(graph, active_f_, req_f, offensive_utilization, step_budget, stop_token);
+                offensive_solve_time = offensive_solving_timer.elapsed();
+            });
+        };
+        const auto defensive_planning = solver->supportsDefensivePlanning();
+        const auto offensive_planning_enabled = options.isUseOffensivePlanning() and not req_f.empty();
+        // concurrently to defensive planning only if further threads are granted, the offensive result is mostly discarded
+        if(offensive_planning_enabled and (options.getNumberOfThreads() > 1 or not defensive_planning)) {
+            start_offensive_planning();
+        }
 
         // defensive planning
         // ==================
         auto defensive_solving_timer = Timer();
 
-        solver->initialize(graph);
-
-        auto defensive_solution_set = solver->solve(graph, {}, req_f, currently_active_utilization_);
-        auto defensive_solve_time = defensive_solving_timer.elapsed();
+        // the retries of the lazy candidate paths share the budget with the first solve, zero is no limit as for step_budget
+        const auto defensive_deadline = std::chrono::steady_clock::now() + step_budget;
+        const auto remaining_step_budget = [&] {
+            if(step_budget.count() == 0) {
+                return step_budget;
+            }
+            return std::chrono::ceil<std::chrono::milliseconds>(defensive_deadline - std::chrono::steady_clock::now());
+        };
+
+        solver::solutionSet defensive_solution_set;
+        auto defensive_budget_hit = false;
+        if(defensive_planning) {
+            defensive_solution_set = solver->solve(graph, {}, req_f, currently_active_utilization_, step_budget);
+            defensive_budget_hit = solver->isStopped();
+        }
+        // lazy candidate paths: the flows that could not be placed get their next candidate path, until all flows
+        // are placed or their candidates are exhausted. The placed flows keep their slots. Schedulers using only the
+        // first configuration would repeat the failed placement.
+        auto lazy_configuration_time = 0.;
+        const auto lazy_retries = defensive_planning and options.isLazyCandidatePaths() and solver->considersAllConfigurations();
+        while(lazy_retries and defensive_solution_set.size() < req_f.size() and not defensive_budget_hit) {
+            // the offensive planning reads the graph, thus it has to finish before configurations are added
+            if(offensive_planning.joinable()) {
+                offensive_planning.join();
+            }
+            const auto lazy_configuration_timer = Timer();
+            auto unscheduled_f = req_f;
+            for(const auto& flow_id : defensive_solution_set | std::views::keys) {
+                unscheduled_f.erase(flow_id);
+            }
+            const auto retry_f = generateFurtherCandidates(graph, unscheduled_f, options.getCandidatePaths(), options.getNumberOfThreads());
+            lazy_configuration_time += lazy_configuration_timer.elapsed();
+            if(retry_f.empty()) {
+                break;
+            }
+            const auto retry_budget = remaining_step_budget();
+            if(step_budget.count() > 0 and retry_budget.count() <= 0) {
+                // the budget ran out while the candidates were generated
+                defensive_budget_hit = true;
+                break;
+            }
+            const auto retry_solution_set = solver->solve(graph, {}, retry_f, currently_active_utilization_, retry_budget);
+            defensive_solution_set.insert(defensive_solution_set.end(), retry_solution_set.begin(), retry_solution_set.end());
+            defensive_budget_hit = solver->isStopped();
+        }
+        pre_configuration_time += lazy_configuration_time;
+        auto defensive_solve_time = defensive_solving_timer.elapsed() - lazy_configuration_time;
 
         auto scheduling_table_sizes = util::calculate_scheduling_table_sizes(currently_active_utilization_);
         auto defensive_log_wrapper = io::MetaDataLog{.flows_scheduled = defensive_solution_set.size() + active_f_.size(),
@@ -55,25 +131,34 @@ auto ScenarioManager::runScenario(const ProgramOptions& options,
                                                      .number_of_frames = util::calculate_number_of_frames(defensive_solution_set, graph) + util::calculate_number_of_frames(active_f_, graph),
                                                      .max_queue_size = util::calculate_max_queue_size(currently_active_utilization_, graph),
                                                      .avg_scheduling_table_size = util::get_average_value(scheduling_table_sizes),
-                                                     .max_scheduling_table_size = *std::ranges::max_element(scheduling_table_sizes)};
+                                                     .max_scheduling_table_size = *std::ranges::max_element(scheduling_table_sizes),
+                                                     .budget_hit = defensive_budget_hit};
 
         auto defensive_post_processing = defensive_solving_timer.elapsed() - defensive_solve_time;
 
 
-        // offensive planning
-        // ==================
-        auto offensive_solving_timer = Timer();
-        solver::solutionSet offensive_solution_set;
-
-        common::NetworkUtilizationList offensive_utilization(graph.getNumberOfEgressQueues(), hyper_cycle, sub_cycle);
-
+        // offensive planning result
+        // =========================
         auto offensive_required = defensive_solution_set.size() < req_f.size();
-        if(offensive_required and options.isUseOffensivePlanning()) {
-            // skip offensive if defensive has already scheduled all flow's
-            offensive_solution_set = solver->solve(graph, active_f_, req_f, offensive_utilization);
+        if(offensive_planning_enabled and offensive_required and not offensive_planning_started) {
+            // sequential offensive planning
+            start_offensive_planning();
+        }
+        if(offensive_planning.joinable()) {
+            if(not offensive_required) {
+                // defensive planning scheduled all flows, the offensive result is not needed
+                offensive_planning.request_stop();
+            }
+            offensive_planning.join();
         }
+        auto offensive_post_processing_timer = Timer();
 
-        auto offensive_solve_time = offensive_solving_timer.elapsed();
+        if(not offensive_required) {
+            // skip offensive if defensive has already scheduled all flow's
+            offensive_solution_set.clear();
+            offensive_utilization.clear();
+            offensive_solve_time = 0.;
+        }
 
         scheduling_table_sizes = util::calculate_scheduling_table_sizes(offensive_utilization);
 
@@ -88,9 +173,10 @@ auto ScenarioManager::runScenario(const ProgramOptions& options,
             .number_of_frames = util::calculate_number_of_frames(offensive_solution_set, graph),
             .max_queue_size = util::calculate_max_queue_size(offensive_utilization, graph),
             .avg_scheduling_table_size = util::get_average_value(scheduling_table_sizes),
-            .max_scheduling_table_size = *std::ranges::max_element(scheduling_table_sizes)};
+            .max_scheduling_table_size = *std::ranges::max_element(scheduling_table_sizes),
+            .budget_hit = offensive_required and options.isUseOffensivePlanning() and offensive_solver->isStopped()};
 
-        auto offensive_post_processing_time = offensive_solving_timer.elapsed() - offensive_solve_time;
+        auto offensive_post_processing_time = offensive_post_processing_timer.elapsed();
 
         auto post_configuration_timer = Timer();
 
@@ -120,12 +206,15 @@ auto ScenarioManager::runScenario(const ProgramOptions& options,
             .number_of_frames = use_defensive_solution ? defensive_log_wrapper.number_of_frames : offensive_log_wrapper.number_of_frames,
             .max_queue_size = use_defensive_solution ? defensive_log_wrapper.max_queue_size : offensive_log_wrapper.max_queue_size,
             .avg_scheduling_table_size = util::get_average_value(scheduling_table_sizes),
-            .max_scheduling_table_size = *std::ranges::max_element(scheduling_table_sizes)};
+            .max_scheduling_table_size = *std::ranges::max_element(scheduling_table_sizes),
+            .budget_hit = use_defensive_solution ? defensive_log_wrapper.budget_hit : offensive_log_wrapper.budget_hit};
 
         if(active_f_.size() < graph.getNumberOfFlows()) {
             // remove rejected flows
             removeRejectedFlows(graph);
         }
+        // the added flows are either active or removed now, neither needs further candidates
+        route_generators_.clear();
         auto post_configuration_time = post_configuration_timer.elapsed();
         defensive_log_wrapper.config_time += post_configuration_time + defensive_post_processing;
         offensive_log_wrapper.config_time += post_configuration_time + offensive_post_processing_time;
@@ -159,7 +248,9 @@ auto ScenarioManager::runScenario(const ProgramOptions& options,
 
 auto ScenarioManager::handleFlowChanges(MultiLayeredGraph& graph, io::TimeStep& time_step,
                                         const std::shared_ptr<routing::AbstractNavigation>& navigator,
-                                        const std::size_t no_candidate_paths)
+                                        const std::size_t no_candidate_paths,
+                                        const std::size_t number_of_threads,
+                                        const bool lazy_candidate_paths)
     -> std::pair<robin_hood::unordered_set<common::FlowNodeID>, double>
 {
     const auto update_config_timer = Timer();
@@ -171,23 +262,125 @@ auto ScenarioManager::handleFlowChanges(MultiLayeredGraph& graph, io::TimeStep&
         active_f_.erase(flow_id);
     });
 
-    // add flows
+    // add flows, routing only reads the graph, thus all routes are computed before the first insertion
+    navigator->updateUtilization(graph, currently_active_utilization_);
+    const auto routes_per_flow = lazy_candidate_paths
+        ? startRouteGenerators(graph, time_step.add_flows, *navigator, number_of_threads)
+        : findRoutesOf(graph, time_step.add_flows, *navigator, no_candidate_paths, number_of_threads);
+
     robin_hood::unordered_set<common::FlowNodeID> req_f;
-    std::ranges::for_each(time_step.add_flows, [&](auto& flow) {
-        auto routes = navigator->findRoutes(flow.source, flow.destination, graph, no_candidate_paths);
+    for(std::size_t index = 0; index < time_step.add_flows.size(); ++index) {
+        auto& flow = time_step.add_flows[index];
         auto flow_id = flow.id;
         graph.addFlow(std::move(flow));
         req_f.insert(flow_id);
 
-        for(const auto& path : routes) {
+        for(const auto& path : routes_per_flow[index]) {
             graph_struct_operations::insertConfiguration(graph, flow_id, path);
         }
-    });
+    }
     auto update_config_time = update_config_timer.elapsed();
     total_insert_config_time_ += update_config_time;
     return std::pair(req_f, update_config_time);
 }
 
+auto ScenarioManager::findRoutesOf(const MultiLayeredGraph& graph,
+                                   const std::vector<graph_structs::Flow>& flows,
+                                   routing::AbstractNavigation& navigator,
+                                   const std::size_t no_candidate_paths,
+                                   const std::size_t number_of_threads)
+    -> std::vector<std::vector<std::vector<common::NetworkQueueID>>>
+{
+    std::vector<std::vector<std::vector<common::NetworkQueueID>>> routes_per_flow(flows.size());
+    runInParallel(flows.size(), number_of_threads, [&](const std::size_t index) {
+        const auto& flow = flows[index];
+        routes_per_flow[index] = navigator.findRoutes(flow.source, flow.destination, graph, no_candidate_paths);
+    });
+    return routes_per_flow;
+}
+
+auto ScenarioManager::startRouteGenerators(const MultiLayeredGraph& graph,
+                                           const std::vector<graph_structs::Flow>& flows,
+                                           routing::AbstractNavigation& navigator,
+                                           const std::size_t number_of_threads)
+    -> std::vector<std::vector<std::vector<common::NetworkQueueID>>>
+{
+    std::vector<std::unique_ptr<routing::RouteGenerator>> generators;
+    generators.reserve(flows.size());
+    for(const auto& flow : flows) {
+        generators.emplace_back(navigator.createRouteGenerator(flow.source, flow.destination));
+    }
+
+    std::vector<std::vector<std::vector<common::NetworkQueueID>>> routes_per_flow(flows.size());
+    runInParallel(flows.size(), number_of_threads, [&](const std::size_t index) {
+        if(auto route = generators[index]->next(graph); route.has_value()) {
+            routes_per_flow[index].emplace_back(std::move(route.value()));
+        }
+    });
+
+    for(std::size_t index = 0; index < flows.size(); ++index) {
+        route_generators_.emplace(flows[index].id, std::move(generators[index]));
+    }
+    return routes_per_flow;
+}
+
+auto ScenarioManager::generateFurtherCandidates(MultiLayeredGraph& graph,
+                                                const robin_hood::unordered_set<common::FlowNodeID>& flows,
+                                                const std::size_t no_candidate_paths,
+                                                const std::size_t number_of_threads)
+    -> robin_hood::unordered_set<common::FlowNodeID>
+{
+    // sorted, so that the configuration ids do not depend on the hash order
+    std::vector<common::FlowNodeID> expandable_flows;
+    for(const auto flow_id : flows) {
+        if(route_generators_.contains(flow_id) and graph.getFlow(flow_id).configurations.size() < no_candidate_paths) {
+            expandable_flows.emplace_back(flow_id);
+        }
+    }
+    std::ranges::sort(expandable_flows);
+
+    std::vector<std::optional<std::vector<common::NetworkQueueID>>> routes(expandable_flows.size());
+    runInParallel(expandable_flows.size(), number_of_threads, [&](const std::size_t index) {
+        routes[index] = route_generators_.find(expandable_flows[index])->second->next(graph);
+    });
+
+    robin_hood::unordered_set<common::FlowNodeID> expanded_flows;
+    for(std::size_t index = 0; index < expandable_flows.size(); ++index) {
+        const auto flow_id = expandable_flows[index];
+        if(routes[index].has_value()) {
+            graph_struct_operations::insertConfiguration(graph, flow_id, routes[index].value());
+            expanded_flows.insert(flow_id);
+        } else {
+            route_generators_.erase(flow_id);
+        }
+    }
+    return expanded_flows;
+}
+
+auto ScenarioManager::runInParallel(const std::size_t count,
+                                    const std::size_t number_of_threads,
+                                    const std::function<void(std::size_t)>& task) -> void
+{
+    const auto number_of_workers = std::min(number_of_threads, count);
+    if(number_of_workers <= 1) {
+        for(std::size_t index = 0; index < count; ++index) {
+            task(index);
+        }
+        return;
+    }
+
+    std::atomic<std::size_t> next_index{0};
+    std::vector<std::jthread> workers;
+    workers.reserve(number_of_workers);
+    for(auto i = std::size_t{0}; i < number_of_workers; ++i) {
+        workers.emplace_back([&] {
+            for(auto index = next_index++; index < count; index = next_index++) {
+                task(index);
+            }
+        });
+    }
+}
+
 auto ScenarioManager::removeRejectedFlows(MultiLayeredGraph& graph) -> void
 {
     std::vector<common::FlowNodeID> to_be_removed;
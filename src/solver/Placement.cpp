@@ -26,6 +26,20 @@ auto placement::placeConfigASAP(const graph_structs::Configuration& current_conf
                                 const graph_structs::Flow& current_flow,
                                 common::NetworkUtilizationList& utilizationList)
     -> bool
+{
+    const auto required_slots = searchSlotsASAP(current_config, current_flow, utilizationList);
+    if(required_slots.empty()) {
+        return false;
+    }
+
+    reserveSlots(required_slots, current_config, current_flow, utilizationList);
+    return true;
+}
+
+auto placement::searchSlotsASAP(const graph_structs::Configuration& current_config,
+                                const graph_structs::Flow& current_flow,
+                                const common::NetworkUtilizationList& utilizationList)
+    -> std::vector<std::vector<common::SlotReservationRequest>>
 {
     const auto frames_per_hyper_cycle = utilizationList.compute_frames_per_hc(current_flow.period);
     // Tuple: (Network Queue ID, start sending time, end sending time, arrival time)
@@ -41,22 +55,25 @@ auto placement::placeConfigASAP(const graph_structs::Configuration& current_conf
         return true;
     });
     if(not success) {
-        return false;
+        return {};
     }
+    return required_slots;
+}
 
-    // reserve the required slots
+auto placement::reserveSlots(const std::vector<std::vector<common::SlotReservationRequest>>& required_slots,
+                             const graph_structs::Configuration& current_config,
+                             const graph_structs::Flow& current_flow,
+                             common::NetworkUtilizationList& utilizationList)
+    -> void
+{
     std::ranges::for_each(required_slots, [&](auto& required_slots_of_period) {
         std::ranges::for_each(required_slots_of_period, [&](auto& required_slot) {
             utilizationList.reserveSlot(required_slot, current_flow.id, current_config.id);
         });
     });
-
-    return true;
 }
 
 
-
-
 auto placement::placeConfigBalanced(const graph_structs::Configuration& current_config,
                                     const graph_structs::Flow& current_flow,
                                     common::NetworkUtilizationList& utilizationList)
@@ -130,26 +147,21 @@ auto placement::hermesPlacement(const graph_structs::Configuration& configuratio
                                 common::NetworkUtilizationList& utilizationList,
                                 const common::NetworkQueueID egress_queue,
                                 const std::size_t latest_offset)
-    -> bool
+    -> std::optional<std::size_t>
 {
     auto transmission_delay = util::calculate_transmission_delay(flow.frame_size);
-    auto filtered_view = std::ranges::filter_view(utilizationList.getFreeEgressSlots().at(egress_queue.get()),
-                                                  [latest_offset, transmission_delay](auto slot) {
-                                                      auto start = slot.start_time;
-                                                      auto end = slot.last_free_macro_tick;
-                                                      // -1 since the end slot is included in the free slots
-                                                      return start <= latest_offset and end - start >= transmission_delay;
-                                                  });
-    const auto latest_slot = std::ranges::max_element(filtered_view,
-                                                      [](auto lhs, auto rhs) {
-                                                          // find latest slot
-                                                          return lhs.start_time < rhs.start_time;
-                                                      });
+    const auto latest_slot = utilizationList.findLatestFreeSlot(egress_queue, latest_offset, transmission_delay);
+    if(not latest_slot.has_value()) {
+        return std::nullopt;
+    }
 
     const auto start_time = std::min(latest_slot->last_free_macro_tick - transmission_delay + 1, latest_offset);
     const auto next_slot_start_time = start_time + transmission_delay;
     // Tuple: (Network Queue ID, start sending time, end sending time, arrival time) - arrival time is incorrect since unknown at this time
-    return utilizationList.reserveSlot(
-        common::SlotReservationRequest{.egress_queue = egress_queue, .start_time = start_time, .next_slot_start = next_slot_start_time, .arrival_time = start_time},
-        flow.id, configuration.id);
+    if(not utilizationList.reserveSlot(
+           common::SlotReservationRequest{.egress_queue = egress_queue, .start_time = static_cast<common::Tick>(start_time), .next_slot_start = static_cast<common::Tick>(next_slot_start_time), .arrival_time = static_cast<common::Tick>(start_time)},
+           flow.id, configuration.id)) {
+        return std::nullopt;
+    }
+    return start_time;
 }
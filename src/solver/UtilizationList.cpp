@@ -59,7 +59,7 @@ auto common::NetworkUtilizationList::searchTransmissionOpportunities(const graph
     const auto constraint_sufficient_slot_time_before_deadline = [current_transmission_delay, effective_deadline, &running_arrival_time](const auto& slot) {
         // there is enough time in the slot to transmit the frame and for the frame to reach the next hop before the deadline
         // +1 so we have the actual slot end
-        return std::max(slot.start_time, running_arrival_time) + current_transmission_delay <= std::min(slot.last_free_macro_tick + 1, effective_deadline + current_transmission_delay);
+        return std::max<std::size_t>(slot.start_time, running_arrival_time) + current_transmission_delay <= std::min<std::size_t>(slot.last_free_macro_tick + 1, effective_deadline + current_transmission_delay);
     };
 
     // Note: we use all_of to be able to break early
@@ -76,7 +76,7 @@ auto common::NetworkUtilizationList::searchTransmissionOpportunities(const graph
         }
         const auto free_slot = *it;
 
-        auto earliest_send_time = std::max(free_slot.start_time, running_arrival_time);
+        auto earliest_send_time = std::max<std::size_t>(free_slot.start_time, running_arrival_time);
 
         required_slots.emplace_back(network_link_id, earliest_send_time, earliest_send_time + current_transmission_delay, running_arrival_time);
         // adding the transmission delay here makes it store-and-forward switching. Replace it by some realistic constant for cut-through.
@@ -230,13 +230,14 @@ auto common::NetworkUtilizationList::reserveSlot(const SlotReservationRequest& r
     // store the slot in the "global" required list
     reserved_egress_slots_.at(requiredSlot.egress_queue.get()).emplace_back(requiredSlot.start_time, requiredSlot.next_slot_start, flow_id, config_id);
 
-    // update the free slots
-    const auto free_slot_iter = std::ranges::find_if(
-        free_egress_slots_.at(requiredSlot.egress_queue.get()),
-        [&](auto slot_pair) {
-            return slot_pair.start_time <= requiredSlot.start_time and slot_pair.last_free_macro_tick >= requiredSlot.next_slot_start - 1;
-        });
-    if(free_slot_iter == free_egress_slots_.at(requiredSlot.egress_queue.get()).end()) {
+    // update the free slots, the only candidate is the last free slot starting before the required slot
+    auto& free_slots = free_egress_slots_.at(requiredSlot.egress_queue.get());
+    auto free_slot_iter = std::ranges::upper_bound(free_slots, requiredSlot.start_time, std::less(), &SingleFreeSlot::start_time);
+    if(free_slot_iter == free_slots.begin()) {
+        return false;
+    }
+    free_slot_iter = std::prev(free_slot_iter);
+    if(free_slot_iter->last_free_macro_tick < requiredSlot.next_slot_start - 1) {
         return false;
     }
     auto& free_slot = *free_slot_iter;
@@ -260,6 +261,26 @@ auto common::NetworkUtilizationList::reserveSlot(const SlotReservationRequest& r
     return true;
 }
 
+auto common::NetworkUtilizationList::findLatestFreeSlot(const NetworkQueueID egress_queue,
+                                                        const std::size_t latest_start,
+                                                        const std::size_t min_length) const
+    -> std::optional<SingleFreeSlot>
+{
+    const auto& free_slots = free_egress_slots_[egress_queue.get()];
+    // the free slots are sorted, walk back from the last slot starting at or before latest_start
+    auto candidates = std::ranges::subrange(free_slots.begin(),
+                                            std::ranges::upper_bound(free_slots, latest_start, std::less(), &SingleFreeSlot::start_time))
+        | std::views::reverse
+        | std::views::filter([min_length](const auto& slot) {
+                          return slot.last_free_macro_tick - slot.start_time >= min_length;
+                      })
+        | std::views::take(1);
+    if(candidates.empty()) {
+        return std::nullopt;
+    }
+    return *candidates.begin();
+}
+
 auto common::NetworkUtilizationList::getFlowArrivalsCopy(NetworkQueueID egress_queue_id) const -> std::vector<std::pair<FlowNodeID, std::size_t>>
 {
     return flow_arrival_.at(egress_queue_id.get());
@@ -279,7 +300,7 @@ auto common::NetworkUtilizationList::clear() -> void
 
     free_egress_slots_.resize(number_of_network_links_);
     std::ranges::for_each(free_egress_slots_, [hyper_cycle = hyper_cycle_](auto& link_slots) {
-        link_slots.emplace_back(SingleFreeSlot{std::size_t{0}, hyper_cycle - 1});
+        link_slots.emplace_back(SingleFreeSlot{Tick{0}, static_cast<Tick>(hyper_cycle - 1)});
     });
 
     reserved_egress_slots_.resize(number_of_network_links_);
@@ -300,3 +321,8 @@ auto common::NetworkUtilizationList::getSubCycle() const -> size_t
 {
     return sub_cycle_;
 }
+
+auto common::NetworkUtilizationList::getHyperCycle() const -> size_t
+{
+    return hyper_cycle_;
+}
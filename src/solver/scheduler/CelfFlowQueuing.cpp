@@ -64,7 +64,7 @@ auto CelfFlowQueuing::scheduleSet(const robin_hood::unordered_set<common::FlowNo
     using PriorityQueue = std::priority_queue<common::ConfigurationNodeID, std::vector<common::ConfigurationNodeID>, decltype(config_comparison)>;
     PriorityQueue heap(config_comparison, heap_vector);
 
-    while(not heap.empty()) {
+    while(not heap.empty() and not stopRequested()) {
         auto top_config = heap.top();
         auto& current_config = graph_.getConfiguration(top_config);
         heap.pop();
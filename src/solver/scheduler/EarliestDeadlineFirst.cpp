@@ -1,12 +1,21 @@
 #include "solver/scheduler/EarliestDeadlineFirst.h"
 #include "fmt/core.h"
-#include "util/Timer.h"
 #include "util/UtilFunctions.h"
-#include <queue>
+#include <ranges>
 
-EarliestDeadlineFirst::EarliestDeadlineFirst(MultiLayeredGraph& graph)
+namespace {
+constexpr auto time_comparison = [](const std::pair<common::NetworkQueueID, std::size_t>& lhs, const std::pair<common::NetworkQueueID, std::size_t>& rhs) {
+    if(lhs.second == rhs.second) {
+        return lhs.first > rhs.first; // tie-breaker with IDs
+    }
+    return lhs.second > rhs.second; // smaller time at the front
+};
+} // namespace
+
+EarliestDeadlineFirst::EarliestDeadlineFirst(MultiLayeredGraph& graph, const bool batch_admission)
     : graph_(graph),
-      hyper_cycle_(util::calculate_hyper_cycle(graph)) // needs to be updated whenever the flow set changes, i.e., when calling solve
+      hyper_cycle_(util::calculate_hyper_cycle(graph)), // needs to be updated whenever the flow set changes, i.e., when calling solve
+      batch_admission_(batch_admission)
 {
 }
 
@@ -14,13 +23,6 @@ auto EarliestDeadlineFirst::solve(const MultiLayeredGraph& graph, const robin_ho
                                   const robin_hood::unordered_set<common::FlowNodeID>& req_f, common::NetworkUtilizationList& network_utilization)
     -> solver::solutionSet
 {
-    if(skip_run_) {
-        // prevent every second run, starting with the first. -> only offensive planning is conducted
-        skip_run_ = false;
-        return {};
-    }
-    skip_run_ = true;
-
     hyper_cycle_ = util::calculate_hyper_cycle(graph);
 
     solver::solutionSet input;
@@ -75,95 +77,117 @@ auto EarliestDeadlineFirst::solve(const MultiLayeredGraph& graph, const robin_ho
         input.emplace_back(std::pair(flow_id, flow.configurations.front()));
     });
 
-    auto timer = Timer();
-    auto temp = simulateEdfPlacement(input, network_utilization);
-    if(temp.has_value()) {
+    resetSimulation(network_utilization.getSubCycle());
+    if(simulateEdfPlacement(input).has_value()) {
         // start from 0 if the traffic approximation was to optimistic
         input.insert(input.end(), missing.begin(), missing.end());
         missing = std::move(input);
+        input.clear();
     }
 
-    for(auto next_flow_config_pair : missing) {
-        input.emplace_back(next_flow_config_pair);
-
-        timer.reset();
-        temp = simulateEdfPlacement(input, network_utilization);
-        if(temp.has_value()) {
-            input.pop_back();
+    if(batch_admission_) {
+        admitBatched(missing, input);
+    } else {
+        for(auto next_flow_config_pair : missing) {
+            if(stopRequested()) {
+                break;
+            }
+            if(not simulateEdfPlacement({next_flow_config_pair}).has_value()) {
+                input.emplace_back(next_flow_config_pair);
+            }
         }
     }
 
+    applyReservations(network_utilization);
     return input;
 }
 
-auto EarliestDeadlineFirst::simulateEdfPlacement(const solver::solutionSet& configs, common::NetworkUtilizationList& utilizationList) const
+auto EarliestDeadlineFirst::resetSimulation(const std::size_t checkpoint_interval) -> void
+{
+    checkpoint_interval_ = checkpoint_interval > 0 ? checkpoint_interval : hyper_cycle_;
+    transmissions_.assign(graph_.getNumberOfEgressQueues(), {});
+
+    // every egress port starts empty at time 0
+    TimeList time_list;
+    time_list.reserve(graph_.getNumberOfEgressQueues());
+    for(auto id = common::UnderlyingID{0}; id < graph_.getNumberOfEgressQueues(); ++id) {
+        time_list.emplace_back(std::pair(common::NetworkQueueID{id}, 0));
+    }
+    std::ranges::make_heap(time_list, time_comparison);
+
+    checkpoints_.clear();
+    checkpoints_.emplace_back(Checkpoint{.time = 0,
+                                         .inbox = std::vector<std::vector<Frame>>(graph_.getNumberOfEgressQueues()),
+                                         .time_list = std::move(time_list)});
+}
+
+auto EarliestDeadlineFirst::simulateEdfPlacement(const solver::solutionSet& configs)
     -> std::optional<common::FlowNodeID>
 {
-    utilizationList.clear();
-    // create an "inbox" for every egress port
-    // tuple: ConfigurationId, time, package_size, period
-    auto inbox = std::vector<std::vector<std::tuple<common::ConfigurationNodeID, std::size_t, std::size_t, std::size_t, std::size_t>>>(graph_.getNumberOfEgressQueues());
-
-    // create a time list for every egress slot -> priority queue with (egressPortId, time) pairs
-    std::vector<std::pair<common::NetworkQueueID, std::size_t>> time_vector;
-    time_vector.reserve(graph_.getNumberOfEgressQueues());
-    for(auto id = std::size_t{0}; id < graph_.getNumberOfEgressQueues(); ++id) {
-        time_vector.emplace_back(std::pair(common::NetworkQueueID{id}, 0));
+    if(configs.empty()) {
+        return std::nullopt;
     }
 
-    auto time_comparison = [](const std::pair<common::NetworkQueueID, std::size_t>& lhs, const std::pair<common::NetworkQueueID, std::size_t>& rhs) {
-        if(lhs.second == rhs.second) {
-            return lhs.first > rhs.first; // tie-breaker with IDs
-        }
-        return lhs.second > rhs.second; // smaller time at the front
-    };
-    using PriorityQueue = std::priority_queue<std::pair<common::NetworkQueueID, std::size_t>, std::vector<std::pair<common::NetworkQueueID, std::size_t>>, decltype(time_comparison)>;
-    PriorityQueue time_list(time_comparison, time_vector);
+    // resume from the latest checkpoint before any of the new frames changes a decision of the reference simulation
+    const auto divergence_time = std::ranges::min(configs | std::views::transform([&](const auto& flow_config_pair) {
+                                                      return findDivergenceTime(flow_config_pair.second);
+                                                  }));
+    const auto& checkpoint = *std::prev(std::ranges::upper_bound(checkpoints_, divergence_time, std::less(), &Checkpoint::time));
+    const auto resume_time = checkpoint.time;
 
-    // assign the flows to the egress ports' inboxes
-    for(auto [flow_id, config_id] : configs) {
-        auto& current_config = graph_.getConfiguration(config_id);
-        auto& egress_port = current_config.path.front();
-        auto& current_flow = graph_.getFlow(flow_id);
+    auto inbox = checkpoint.inbox;
+    auto time_list = checkpoint.time_list;
 
-        // emplace a frame for every period of the flow
-        for(auto i = std::size_t{0}; i < hyper_cycle_ / current_flow.period; ++i) {
-            inbox[egress_port.get()].emplace_back(config_id, i * current_flow.period, current_flow.frame_size, current_flow.period, (i + 1) * current_flow.period);
-        }
-    }
+    // assign the new flows to the egress ports' inboxes
+    addFrames(inbox, configs);
+
+    // checkpoints and transmissions from resume_time on, they replace the reference if the simulation succeeds
+    std::vector<Checkpoint> new_checkpoints;
+    new_checkpoints.emplace_back(Checkpoint{.time = resume_time, .inbox = inbox, .time_list = time_list});
+    auto next_checkpoint_time = resume_time + checkpoint_interval_;
+    std::vector<std::vector<Transmission>> new_transmissions(graph_.getNumberOfEgressQueues());
 
     while(not time_list.empty()) {
-        auto [current_egress_port, current_time] = time_list.top();
-        time_list.pop();
+        auto [current_egress_port, current_time] = time_list.front();
+        if(current_time >= next_checkpoint_time) {
+            // store the state before any egress port is handled at the checkpoint time
+            const auto checkpoint_time = current_time - current_time % checkpoint_interval_;
+            new_checkpoints.emplace_back(Checkpoint{.time = checkpoint_time, .inbox = inbox, .time_list = time_list});
+            next_checkpoint_time = checkpoint_time + checkpoint_interval_;
+        }
+        std::ranges::pop_heap(time_list, time_comparison);
+        time_list.pop_back();
         auto& current_inbox = inbox[current_egress_port.get()];
 
+        const auto push_time = [&time_list, current_egress_port](const std::size_t time) {
+            time_list.emplace_back(std::pair(current_egress_port, time));
+            std::ranges::push_heap(time_list, time_comparison);
+        };
+
         if(not current_inbox.empty()) {
 
             // find the frame with the earliest deadline (to be scheduled next)
             auto [frame_config_id, arrival_time, package_size, period, deadline] =
                 std::reduce(current_inbox.begin(), current_inbox.end(),
-                            std::tuple(common::ConfigurationNodeID{0}, hyper_cycle_ * 10, std::size_t{5000}, hyper_cycle_ * 10, hyper_cycle_ * 10),
-                            [current_time](auto& lhs, auto& rhs) {
-                                auto [lhs_id, lhs_time, lhs_package_size, lhs_period, lhs_deadline] = lhs;
-                                auto [rhs_id, rhs_time, rhs_package_size, rhs_period, rhs_deadline] = rhs;
-
-                                if(lhs_time <= current_time and rhs_time <= current_time) {
-                                    if(lhs_deadline != rhs_deadline) {
-                                        return lhs_deadline < rhs_deadline ? lhs : rhs;
+                            Frame{common::ConfigurationNodeID{0}, hyper_cycle_ * 10, std::size_t{5000}, hyper_cycle_ * 10, hyper_cycle_ * 10},
+                            [current_time](const Frame& lhs, const Frame& rhs) {
+                                if(lhs.arrival_time <= current_time and rhs.arrival_time <= current_time) {
+                                    if(lhs.deadline != rhs.deadline) {
+                                        return lhs.deadline < rhs.deadline ? lhs : rhs;
                                     }
-                                    if(lhs_period != rhs_period) {
-                                        return lhs_period < rhs_period ? lhs : rhs;
+                                    if(lhs.period != rhs.period) {
+                                        return lhs.period < rhs.period ? lhs : rhs;
                                     }
-                                    return lhs_id < rhs_id ? lhs : rhs;
+                                    return lhs.config_id < rhs.config_id ? lhs : rhs;
                                 }
-                                return lhs_time < rhs_time ? lhs : rhs;
+                                return lhs.arrival_time < rhs.arrival_time ? lhs : rhs;
                             });
 
             if(arrival_time <= current_time) {
                 //  remove the frame from the inbox
                 std::erase_if(current_inbox, [frame_config_id, arrival_time](const auto& element) {
-                    const bool id_check = std::get<0>(element).get() == frame_config_id.get();
-                    const bool arrival_time_check = std::get<1>(element) == arrival_time;
+                    const bool id_check = element.config_id.get() == frame_config_id.get();
+                    const bool arrival_time_check = element.arrival_time == arrival_time;
                     return id_check and arrival_time_check;
                 });
 
@@ -195,23 +219,131 @@ auto EarliestDeadlineFirst::simulateEdfPlacement(const solver::solutionSet& conf
                         return frame_config.flow;
                     }
                 }
-                // update utilization list
-                utilizationList.reserveSlot(common::SlotReservationRequest{.egress_queue = current_egress_port, .start_time = current_time, .next_slot_start = current_time + transmission_time, .arrival_time = arrival_time},
-                                            frame_config.flow,
-                                            frame_config.id);
+                // remember the transmission, it is written into the utilization list once the admission is done
+                new_transmissions[current_egress_port.get()].emplace_back(Transmission{.start_time = current_time,
+                                                                                       .next_slot_start = current_time + transmission_time,
+                                                                                       .arrival_time = arrival_time,
+                                                                                       .deadline = deadline,
+                                                                                       .period = period,
+                                                                                       .flow_id = frame_config.flow,
+                                                                                       .config_id = frame_config.id});
                 // egress port is ready again at:
-                time_list.push(std::pair(current_egress_port, current_time + transmission_time));
+                push_time(current_time + transmission_time);
             } else {
                 // the inbox has packages arriving later -> check again later
-                time_list.push(std::pair(current_egress_port, current_time + 1));
+                push_time(current_time + 1);
             }
         } else {
             if(current_time < hyper_cycle_) {
                 // there are currently no packages in the inbox -> check again later
-                time_list.push(std::pair(current_egress_port, current_time + 1));
+                push_time(current_time + 1);
             }
         }
     }
-    // if all assignments work: success, return true
+
+    // all assignments work: the simulation becomes the new reference
+    std::erase_if(checkpoints_, [resume_time](const auto& old_checkpoint) {
+        return old_checkpoint.time >= resume_time;
+    });
+    // the frames of configs are still waiting at their first egress port in the remaining checkpoints
+    for(auto& old_checkpoint : checkpoints_) {
+        addFrames(old_checkpoint.inbox, configs);
+    }
+    std::ranges::move(new_checkpoints, std::back_inserter(checkpoints_));
+
+    for(auto id = std::size_t{0}; id < transmissions_.size(); ++id) {
+        auto& port_transmissions = transmissions_[id];
+        port_transmissions.erase(std::ranges::lower_bound(port_transmissions, resume_time, std::less(), &Transmission::start_time),
+                                 port_transmissions.end());
+        std::ranges::move(new_transmissions[id], std::back_inserter(port_transmissions));
+    }
     return std::nullopt;
 }
+
+auto EarliestDeadlineFirst::addFrames(std::vector<std::vector<Frame>>& inbox, const solver::solutionSet& configs) const -> void
+{
+    for(auto [flow_id, config_id] : configs) {
+        auto& current_config = graph_.getConfiguration(config_id);
+        auto& egress_port = current_config.path.front();
+        auto& current_flow = graph_.getFlow(flow_id);
+
+        // emplace a frame for every period of the flow
+        for(auto i = std::size_t{0}; i < hyper_cycle_ / current_flow.period; ++i) {
+            inbox[egress_port.get()].emplace_back(config_id, i * current_flow.period, current_flow.frame_size, current_flow.period, (i + 1) * current_flow.period);
+        }
+    }
+}
+
+auto EarliestDeadlineFirst::findDivergenceTime(const common::ConfigurationNodeID config_id) const -> std::size_t
+{
+    /*
+     * The frames of the config enter the simulation at the first egress port of its path.
+     * The reference simulation stays valid until that port is idle or sends a frame the new frame would have been preferred to.
+     */
+    const auto& config = graph_.getConfiguration(config_id);
+    const auto& flow = graph_.getFlow(config.flow);
+    const auto& port_transmissions = transmissions_[config.path.front().get()];
+
+    auto divergence_time = std::numeric_limits<std::size_t>::max();
+    for(auto frame_no = std::size_t{0}; frame_no < hyper_cycle_ / flow.period; ++frame_no) {
+        const auto arrival_time = frame_no * flow.period;
+        if(arrival_time >= divergence_time) {
+            break;
+        }
+        const auto frame_priority = std::tuple(arrival_time + flow.period, flow.period, config_id);
+
+        auto current_time = arrival_time;
+        auto transmission_it = std::ranges::lower_bound(port_transmissions, current_time, std::less(), &Transmission::next_slot_start);
+        while(current_time < divergence_time) {
+            if(transmission_it == port_transmissions.end() or transmission_it->start_time > current_time) {
+                // the port is idle and would send the new frame
+                break;
+            }
+            if(transmission_it->start_time == current_time
+               and frame_priority < std::tuple(transmission_it->deadline, transmission_it->period, transmission_it->config_id)) {
+                // the new frame would have been sent instead
+                break;
+            }
+            // the port is busy until the end of the transmission
+            current_time = transmission_it->next_slot_start;
+            transmission_it = std::next(transmission_it);
+        }
+        divergence_time = std::min(divergence_time, current_time);
+    }
+    return divergence_time;
+}
+
+auto EarliestDeadlineFirst::admitBatched(const solver::solutionSet& candidates, solver::solutionSet& admitted) -> void
+{
+    auto next_candidate = candidates.begin();
+    auto batch_size = std::size_t{1};
+
+    while(next_candidate != candidates.end() and not stopRequested()) {
+        batch_size = std::min(batch_size, static_cast<std::size_t>(std::distance(next_candidate, candidates.end())));
+        const solver::solutionSet batch(next_candidate, std::next(next_candidate, static_cast<std::ptrdiff_t>(batch_size)));
+
+        if(not simulateEdfPlacement(batch).has_value()) {
+            admitted.insert(admitted.end(), batch.begin(), batch.end());
+            next_candidate = std::next(next_candidate, static_cast<std::ptrdiff_t>(batch_size));
+            batch_size *= 2;
+        } else if(batch_size > 1) {
+            // retry with the first half of the batch
+            batch_size /= 2;
+        } else {
+            // the flow does not fit on its own
+            next_candidate = std::next(next_candidate);
+        }
+    }
+}
+
+auto EarliestDeadlineFirst::applyReservations(common::NetworkUtilizationList& utilizationList) const -> void
+{
+    utilizationList.clear();
+    for(auto id = common::UnderlyingID{0}; id < transmissions_.size(); ++id) {
+        for(const auto& transmission : transmissions_[id]) {
+            utilizationList.reserveSlot(common::SlotReservationRequest{.egress_queue = common::NetworkQueueID{id}, .start_time = static_cast<common::Tick>(transmission.start_time), .next_slot_start = static_cast<common::Tick>(transmission.next_slot_start), .arrival_time = static_cast<common::Tick>(transmission.arrival_time)},
+                                        transmission.flow_id,
+                                        transmission.config_id);
+        }
+    }
+}
@@ -1,9 +1,17 @@
 
 #include "solver/scheduler/FirstFit.h"
 #include "solver/Placement.h"
+#include <array>
+#include <atomic>
+#include <barrier>
+#include <limits>
+#include <optional>
+#include <span>
+#include <thread>
 
-FirstFit::FirstFit(MultiLayeredGraph& graph)
-    : graph_(graph)
+FirstFit::FirstFit(MultiLayeredGraph& graph, const std::size_t number_of_threads)
+    : graph_(graph),
+      number_of_threads_(std::max(number_of_threads, std::size_t{1}))
 {
 }
 
@@ -12,6 +20,16 @@ auto FirstFit::name() -> std::string
     return "FirstFit";
 }
 
+auto FirstFit::clone() const -> std::unique_ptr<solver::AbstractScheduler>
+{
+    return std::make_unique<FirstFit>(*this);
+}
+
+auto FirstFit::considersAllConfigurations() const -> bool
+{
+    return false;
+}
+
 auto FirstFit::solve(const MultiLayeredGraph& graph,
                      const robin_hood::unordered_set<common::FlowNodeID>& active_f,
                      const robin_hood::unordered_set<common::FlowNodeID>& req_f,
@@ -42,7 +60,15 @@ auto FirstFit::add_flows(const robin_hood::unordered_set<common::FlowNodeID>& se
     std::ranges::for_each(search_f, [&](auto f) { flow_list.emplace_back(f); });
     std::ranges::sort(flow_list);
 
+    if(number_of_threads_ > 1) {
+        add_flows_parallel(flow_list, utilization, result_set);
+        return;
+    }
+
     for(auto flow_id : flow_list) {
+        if(stopRequested()) {
+            break;
+        }
         // add all search_f flows to the network utilization
         auto& flow = graph_.getFlow(flow_id);
         auto config_id = flow.configurations.front();
@@ -53,3 +79,120 @@ auto FirstFit::add_flows(const robin_hood::unordered_set<common::FlowNodeID>& se
         }
     }
 }
+
+auto FirstFit::add_flows_parallel(const std::vector<common::FlowNodeID>& flow_list,
+                                  common::NetworkUtilizationList& utilization,
+                                  solver::solutionSet& result_set)
+    -> void
+{
+    using SlotRequests = std::vector<std::vector<common::SlotReservationRequest>>;
+
+    const auto window_size = number_of_threads_ * 8;
+    const auto number_of_windows = (flow_list.size() + window_size - 1) / window_size;
+    const auto get_window = [&](const std::size_t window_index) {
+        const auto window_start = window_index * window_size;
+        return std::span(flow_list).subspan(window_start, std::min(window_size, flow_list.size() - window_start));
+    };
+
+    // the search of window n runs while window n - 1 is committed, thus the results of two windows are kept
+    std::array<std::vector<std::optional<SlotRequests>>, 2> speculative_slots;
+    // last round in which a commit could modify the link
+    std::vector<std::size_t> link_round(graph_.getNumberOfEgressQueues(), std::numeric_limits<std::size_t>::max());
+
+    // version of the utilization at the last commit that modified a link
+    std::vector<std::size_t> link_version(graph_.getNumberOfEgressQueues(), 0);
+    std::size_t version = 0;
+
+    // state of the current round, only modified by this thread between the barriers
+    std::size_t search_index = 0;
+    std::span<const common::FlowNodeID> search_window;
+    std::atomic<std::size_t> next_index{0};
+    bool finished = false;
+
+    /*
+     * Searches the placements of search_window against the utilization. The commit of the previous window runs
+     * concurrently and only modifies the links of its flows, thus flows sharing a link with it are left to the commit.
+     */
+    const auto search = [&, &const_graph = std::as_const(graph_), &const_utilization = std::as_const(utilization)] {
+        auto& results = speculative_slots[search_index % 2];
+        for(auto index = next_index++; index < search_window.size(); index = next_index++) {
+            const auto& flow = const_graph.getFlow(search_window[index]);
+            const auto& config = const_graph.getConfiguration(flow.configurations.front());
+            const auto conflicts = std::ranges::any_of(config.path, [&](auto link_id) {
+                return link_round[link_id.get()] == search_index;
+            });
+            if(not conflicts) {
+                results[index] = placement::searchSlotsASAP(config, flow, const_utilization);
+            }
+        }
+    };
+
+    // commit in flow ID order
+    const auto commit = [&](const std::size_t window_index) {
+        const auto window = get_window(window_index);
+        auto& results = speculative_slots[window_index % 2];
+        const auto snapshot_version = version;
+        for(auto index = std::size_t{0}; index < window.size() and not stopRequested(); ++index) {
+            auto& flow = graph_.getFlow(window[index]);
+            auto config_id = flow.configurations.front();
+            const auto& config = graph_.getConfiguration(config_id);
+
+            auto& required_slots = results[index];
+            const auto outdated = std::ranges::any_of(config.path, [&](auto link_id) {
+                return link_version[link_id.get()] > snapshot_version;
+            });
+            if(not required_slots.has_value() or outdated) {
+                required_slots = placement::searchSlotsASAP(config, flow, utilization);
+            }
+            if(required_slots->empty()) {
+                continue;
+            }
+
+            placement::reserveSlots(*required_slots, config, flow, utilization);
+            ++version;
+            for(auto link_id : config.path) {
+                link_version[link_id.get()] = version;
+            }
+            result_set.emplace_back(std::make_pair(window[index], config_id));
+        }
+    };
+
+    // the pool lives for the whole call, this thread commits and joins the search afterwards
+    std::barrier round_barrier(static_cast<std::ptrdiff_t>(number_of_threads_));
+    std::vector<std::jthread> workers;
+    workers.reserve(number_of_threads_ - 1);
+    for(auto i = std::size_t{1}; i < number_of_threads_; ++i) {
+        workers.emplace_back([&] {
+            for(round_barrier.arrive_and_wait(); not finished; round_barrier.arrive_and_wait()) {
+                search();
+                round_barrier.arrive_and_wait();
+            }
+        });
+    }
+
+    // round n searches window n and commits window n - 1
+    for(auto round = std::size_t{0}; round <= number_of_windows and not stopRequested(); ++round) {
+        search_index = round;
+        search_window = round < number_of_windows ? get_window(round) : std::span<const common::FlowNodeID>{};
+        next_index = 0;
+        speculative_slots[round % 2].assign(search_window.size(), std::nullopt);
+        if(round > 0) {
+            for(const auto flow_id : get_window(round - 1)) {
+                const auto& flow = graph_.getFlow(flow_id);
+                for(auto link_id : graph_.getConfiguration(flow.configurations.front()).path) {
+                    link_round[link_id.get()] = round;
+                }
+            }
+        }
+
+        round_barrier.arrive_and_wait();
+        if(round > 0) {
+            commit(round - 1);
+        }
+        search();
+        round_barrier.arrive_and_wait();
+    }
+
+    finished = true;
+    round_barrier.arrive_and_wait();
+}
@@ -13,6 +13,16 @@ auto Hermes::name() -> std::string
     return "Hermes";
 }
 
+auto Hermes::clone() const -> std::unique_ptr<solver::AbstractScheduler>
+{
+    return std::make_unique<Hermes>(*this);
+}
+
+auto Hermes::considersAllConfigurations() const -> bool
+{
+    return false;
+}
+
 auto Hermes::solve(const MultiLayeredGraph& graph,
                    const robin_hood::unordered_set<common::FlowNodeID>& active_f,
                    const robin_hood::unordered_set<common::FlowNodeID>& req_f,
@@ -33,38 +43,44 @@ auto Hermes::divPhases()
     -> std::optional<robin_hood::unordered_map<common::NetworkQueueID, std::size_t>>
 {
     std::vector<std::size_t> phases(graph_.getNumberOfEgressQueues(), 0);
+    auto unassigned_segments = phases.size();
     for(auto& egress_queue : graph_.getEgressQueues()) {
         // handle unused links
-        if(egress_queue.used_by.empty()) {
+        if(graph_.getUsersOf(egress_queue.id).empty()) {
             phases[egress_queue.id.get()] = 1;
+            --unassigned_segments;
         }
     }
 
-    std::size_t phi = 1;
+    // number of leading path segments that might still be without a phase, per configuration
+    robin_hood::unordered_map<common::ConfigurationNodeID, std::size_t> unassigned_prefix;
+    unassigned_prefix.reserve(graph_.getNumberOfConfigs());
+    for(const auto& [config_id, config] : graph_.getConfigurations()) {
+        unassigned_prefix[config_id] = config.path.size();
+    }
 
-    while(std::ranges::any_of(phases, [](auto v) { return v == 0; })) {
+    // paths via flows, a path is dropped once all of its segments have a phase
+    std::vector<common::ConfigurationNodeID> open_paths;
+    open_paths.reserve(graph_.getNumberOfFlows());
+    for(const auto& [flow_id, flow] : graph_.getFlows()) {
+        open_paths.emplace_back(flow.configurations.front()); // HERMES assumes to have only one path per flow
+    }
 
+    std::size_t phi = 1;
 
-        // loop paths via flows
-        for(const auto& [flow_id, flow] : graph_.getFlows()) {
-            auto config_id = flow.configurations.front(); // HERMES assumes to have only one path per flow
-            const auto& config = graph_.getConfiguration(config_id);
+    while(unassigned_segments > 0) {
 
-            auto next_path_segment = getNextPathSegmentForPhase(phases, config.path, phi);
+        for(const auto config_id : open_paths) {
+            auto next_path_segment = getNextPathSegmentForPhase(phases, unassigned_prefix, config_id, phi);
 
             if(not next_path_segment.has_value()) {
                 continue;
             }
 
             // check if the next_path_segment is somewhere else not the last segment
-            auto delay = std::ranges::any_of(graph_.getConfigurations(), [&](auto tuple) {
-                auto& [current_id, current_config] = tuple;
-
-                if(not util::vector_contains(current_config.path, next_path_segment.value())) {
-                    return false;
-                }
+            auto delay = std::ranges::any_of(graph_.getUsersOf(next_path_segment.value()), [&](auto current_id) {
                 // next_path_segment is part of the current path
-                auto current_next_segment = getNextPathSegmentForPhase(phases, current_config.path, phi);
+                auto current_next_segment = getNextPathSegmentForPhase(phases, unassigned_prefix, current_id, phi);
 
                 if(not current_next_segment.has_value()) {
                     return false;
@@ -73,8 +89,9 @@ auto Hermes::divPhases()
                 // if they are not the same, the next_path_segment needs to be delayed
                 return next_path_segment.value().get() != current_next_segment.value().get();
             });
-            if(not delay) {
+            if(not delay and phases[next_path_segment.value().get()] == 0) {
                 phases[next_path_segment.value().get()] = phi;
+                --unassigned_segments;
             }
         }
 
@@ -83,6 +100,9 @@ auto Hermes::divPhases()
             return {};
         }
 
+        std::erase_if(open_paths, [&](auto config_id) {
+            return unassigned_prefix[config_id] == 0;
+        });
         ++phi;
     }
 
@@ -97,29 +117,32 @@ auto Hermes::divPhases()
     return phase_map;
 }
 
-auto Hermes::getNextPathSegmentForPhase(std::vector<std::size_t>& phases, const std::vector<common::NetworkQueueID>& path, const std::size_t phi)
+auto Hermes::getNextPathSegmentForPhase(const std::vector<std::size_t>& phases,
+                                        robin_hood::unordered_map<common::ConfigurationNodeID, std::size_t>& unassigned_prefix,
+                                        const common::ConfigurationNodeID config_id,
+                                        const std::size_t phi) const
     -> std::optional<common::NetworkQueueID>
 {
-    const auto iter = std::ranges::find(
-        path.rbegin(), path.rend(),
-        std::size_t{0},
-        [&phases](auto id) {
-            return phases.at(id.get());
-        });
+    const auto& path = graph_.getConfiguration(config_id).path;
+    // segments only ever get a phase, so the last segment without phase moves towards the path's start
+    auto& prefix = unassigned_prefix[config_id];
+    while(prefix > 0 and phases[path[prefix - 1].get()] != 0) {
+        --prefix;
+    }
 
-    if(iter == path.rend()) {
+    if(prefix == 0) {
         return std::nullopt;
     }
 
-    if(iter != path.rbegin()) {
+    if(prefix < path.size()) {
         // ensure we don't assign phi to adjacent links
-        auto prev_id = *std::prev(iter);
-        if(phases.at(prev_id.get()) == phi) {
+        auto prev_id = path[prefix];
+        if(phases[prev_id.get()] == phi) {
             return prev_id;
         }
     }
 
-    return *iter;
+    return path[prefix - 1];
 }
 
 auto Hermes::assignFrameUtilization() -> std::vector<float>
@@ -144,6 +167,8 @@ auto Hermes::schedule(const robin_hood::unordered_map<common::NetworkQueueID, st
     solver::solutionSet solution;
 
     const auto hyper_cycle = util::calculate_hyper_cycle(graph_);
+    // start times of the frames placed by this solve per egress queue and flow, sorted, to find a frame on the next link
+    std::vector<robin_hood::unordered_map<common::FlowNodeID, std::vector<std::size_t>>> placed_frames(graph_.getNumberOfEgressQueues());
     auto max_phi = std::ranges::max_element(phases, std::less(), [&](auto tuple) { return tuple.second; })->second;
     for(std::size_t phase = 1; phase <= max_phi; ++phase) {
         //
@@ -152,8 +177,8 @@ auto Hermes::schedule(const robin_hood::unordered_map<common::NetworkQueueID, st
                 | std::ranges::views::filter([phase](auto& tuple) { return tuple.second == phase; })
                 | std::ranges::views::transform([](auto& tuple) { return tuple.first; })) {
             // loop links
-            const auto& egress_queue = graph_.getEgressQueue(link_id);
-            auto used_by_copy = egress_queue.used_by;
+            const auto users = graph_.getUsersOf(link_id);
+            std::vector used_by_copy(users.begin(), users.end());
             std::ranges::sort(used_by_copy, [&](auto lhs_config, auto rhs_config) {
                 // order by largest frame_utilization first
                 return frame_utilization.at(lhs_config.get()) > frame_utilization.at(rhs_config.get());
@@ -174,22 +199,26 @@ auto Hermes::schedule(const robin_hood::unordered_map<common::NetworkQueueID, st
                             return deadline;
                         }
                         // get the reserved slot on the next link of the current period (there should be only one)
-                        auto reserved_slots = network_utilization.getReservedSlotsOf(*next_link, flow.id);
-                        for(auto& slot : reserved_slots | std::views::filter([deadline, &flow](const auto& current_slot) {
-                                             auto start = current_slot.start_time;
-                                             return start < deadline and start >= deadline - flow.period; // within the current period
-                                         })) {
-                            return slot.start_time - constant::processing_delay;
+                        const auto& next_link_frames = placed_frames[next_link->get()];
+                        if(const auto frames = next_link_frames.find(flow.id); frames != next_link_frames.end()) {
+                            const auto start_time = std::ranges::lower_bound(frames->second, deadline - flow.period);
+                            if(start_time != frames->second.end() and *start_time < deadline) {
+                                // within the current period
+                                return *start_time - constant::processing_delay;
+                            }
                         }
                         // default if something went wrong
                         return deadline;
                     }();
                     // latest_offset: current frame must be sent latest at this time
                     std::size_t latest_offset = std::min(deadline, prev_offset) - constant::propagation_delay - util::calculate_transmission_delay(flow.frame_size);
-                    if(not placement::hermesPlacement(config, flow, network_utilization, egress_queue.id, latest_offset)) {
+                    const auto start_time = placement::hermesPlacement(config, flow, network_utilization, link_id, latest_offset);
+                    if(not start_time.has_value()) {
                         // assignment failed
                         return solver::solutionSet();
                     }
+                    auto& frames = placed_frames[link_id.get()][flow.id];
+                    frames.insert(std::ranges::upper_bound(frames, start_time.value()), start_time.value());
                 }
             }
         }
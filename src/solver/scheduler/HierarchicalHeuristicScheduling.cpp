@@ -60,7 +60,7 @@ auto HierarchicalHeuristicScheduling::scheduleSet(const robin_hood::unordered_se
     solver::solutionSet result_set;
 
 
-    while(not flow_heap.empty()) {
+    while(not flow_heap.empty() and not stopRequested()) {
         auto current_flow_id = flow_heap.top();
         auto current_flow = graph_.getFlow(current_flow_id);
         flow_heap.pop();
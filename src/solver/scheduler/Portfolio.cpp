@@ -0,0 +1,93 @@
+#include "solver/scheduler/Portfolio.h"
+#include "util/Timer.h"
+#include "util/UtilFunctions.h"
+#include <fmt/core.h>
+#include <fmt/ranges.h>
+#include <thread>
+
+Portfolio::Portfolio(std::vector<std::unique_ptr<solver::AbstractScheduler>> schedulers)
+    : schedulers_(std::move(schedulers))
+{
+}
+
+auto Portfolio::name() -> std::string
+{
+    std::vector<std::string> names;
+    names.reserve(schedulers_.size());
+    std::ranges::for_each(schedulers_, [&names](auto& scheduler) { names.emplace_back(scheduler->name()); });
+    return fmt::format("Portfolio({})", fmt::join(names, ","));
+}
+
+auto Portfolio::clone() const -> std::unique_ptr<solver::AbstractScheduler>
+{
+    std::vector<std::unique_ptr<solver::AbstractScheduler>> schedulers;
+    schedulers.reserve(schedulers_.size());
+    std::ranges::for_each(schedulers_, [&schedulers](const auto& scheduler) { schedulers.emplace_back(scheduler->clone()); });
+    return std::make_unique<Portfolio>(std::move(schedulers));
+}
+
+auto Portfolio::supportsDefensivePlanning() const -> bool
+{
+    return std::ranges::all_of(schedulers_, [](const auto& scheduler) { return scheduler->supportsDefensivePlanning(); });
+}
+
+auto Portfolio::considersAllConfigurations() const -> bool
+{
+    return std::ranges::any_of(schedulers_, [](const auto& scheduler) { return scheduler->considersAllConfigurations(); });
+}
+
+auto Portfolio::isStopped() const -> bool
+{
+    return std::ranges::any_of(schedulers_, [](const auto& scheduler) { return scheduler->isStopped(); });
+}
+
+auto Portfolio::initialize(const std::any& param) -> void
+{
+    std::ranges::for_each(schedulers_, [&param](auto& scheduler) { scheduler->initialize(param); });
+}
+
+auto Portfolio::solve(const MultiLayeredGraph& graph,
+                      const robin_hood::unordered_set<common::FlowNodeID>& active_f,
+                      const robin_hood::unordered_set<common::FlowNodeID>& req_f,
+                      common::NetworkUtilizationList& network_utilization)
+    -> solver::solutionSet
+{
+    struct Candidate
+    {
+        solver::solutionSet solution;
+        common::NetworkUtilizationList utilization;
+        double solving_time;
+        double traffic;
+    };
+    std::vector<Candidate> candidates(schedulers_.size());
+    // the schedulers share the budget and stop token of this solve
+    const auto budget = getRemainingBudget();
+    const auto stop_token = getStopToken();
+
+    {
+        std::vector<std::jthread> workers;
+        workers.reserve(schedulers_.size());
+        for(auto i = std::size_t{0}; i < schedulers_.size(); ++i) {
+            workers.emplace_back([&, i] {
+                auto& candidate = candidates[i];
+                const auto solving_timer = Timer();
+                // fork the utilization, so the schedulers do not interfere
+                candidate.utilization = network_utilization;
+                candidate.solution = schedulers_[i]->solve(graph, active_f, req_f, candidate.utilization, budget, stop_token);
+                candidate.solving_time = solving_timer.elapsed();
+                candidate.traffic = util::calculate_ingress_traffic(candidate.solution, graph);
+            });
+        }
+    }
+
+    // highest traffic first, ties are won by the faster scheduler
+    auto& best = *std::ranges::max_element(candidates, [](const auto& lhs, const auto& rhs) {
+        if(lhs.traffic != rhs.traffic) {
+            return lhs.traffic < rhs.traffic;
+        }
+        return lhs.solving_time > rhs.solving_time;
+    });
+
+    network_utilization = std::move(best.utilization);
+    return std::move(best.solution);
+}
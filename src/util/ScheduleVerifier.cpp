@@ -10,29 +10,6 @@ struct validationError final : std::runtime_error
         : std::runtime_error{msg} {}
 };
 
-auto findSourceNodeOfQueue(const MultiLayeredGraph &graph, const common::NetworkQueueID queue_id) -> common::NetworkNodeID
-{
-    /* The queue won't tell us it's source, only it's destination. The plan: Go through all nodes that the
-     * destination node is connected to (which includes the node we're looking for) and go though all their
-     * queue ids. When the queue id matches the one we started with, we know which node it belongs to. */
-    const graph_structs::EgressQueue queue_struct = graph.getEgressQueue(queue_id);
-    const common::NetworkNodeID queue_destination = queue_struct.destination;
-
-    // Go through all nodes the destination node is connected to (suspects)
-    for(const graph_structs::EgressQueue &reverse_queue : graph.getEgressQueuesOf(queue_destination)) {
-        const common::NetworkNodeID suspect_node = reverse_queue.destination;
-
-        // Go through all queues that are originating at the suspect.
-        // If the queue id matches, we found the original source node!
-        for(const graph_structs::EgressQueue &suspect_queue : graph.getEgressQueuesOf(suspect_node)) {
-            if(suspect_queue.id == queue_id) {
-                return suspect_node;
-            }
-        }
-    }
-    throw validationError("Network graph is not full duplex");
-}
-
 /**
  * Checks the following rules:
  * - All free egress slots must be at least 1 tick long
@@ -44,7 +21,7 @@ void checkFreeSlotOrder(const MultiLayeredGraph &graph, const std::size_t hyper_
 {
     size_t port_index = 0;
     for(const auto &free_port_slots : free_slots) {
-        const common::NetworkNodeID current_port_source = findSourceNodeOfQueue(graph, common::NetworkQueueID(port_index));
+        const common::NetworkNodeID current_port_source = graph.getSourceOf(common::NetworkQueueID(port_index));
         const common::NetworkNodeID current_port_destination = graph.getEgressQueue(common::NetworkQueueID(port_index)).destination;
         size_t next_allowed_tick = 0;
         size_t slot_index = 0;
@@ -126,7 +103,7 @@ void checkReservedSlotOrder(const MultiLayeredGraph &graph, const std::size_t hy
 {
     size_t port_index = 0;
     for(const auto &reserved_port_slots : reserved_slots) {
-        const common::NetworkNodeID current_port_source = findSourceNodeOfQueue(graph, common::NetworkQueueID(port_index));
+        const common::NetworkNodeID current_port_source = graph.getSourceOf(common::NetworkQueueID(port_index));
         const common::NetworkNodeID current_port_destination = graph.getEgressQueue(common::NetworkQueueID(port_index)).destination;
         size_t next_allowed_tick = 0;
         size_t slot_index = 0;
@@ -188,7 +165,7 @@ void checkSlotsForInverses(const MultiLayeredGraph &graph, const std::size_t hyp
         throw validationError("The list for free slots and the list for reserved slots don't agree on the number of egress queues");
     }
     for(size_t port_index = 0; port_index < free_slots.size(); ++port_index) {
-        const common::NetworkNodeID current_port_source = findSourceNodeOfQueue(graph, common::NetworkQueueID(port_index));
+        const common::NetworkNodeID current_port_source = graph.getSourceOf(common::NetworkQueueID(port_index));
         const common::NetworkNodeID current_port_destination = graph.getEgressQueue(common::NetworkQueueID(port_index)).destination;
         common::FreeSlots free_port_slots = free_slots[port_index];
         common::ReservedSlots reserved_port_slots = reserved_slots[port_index];
@@ -312,7 +289,7 @@ void check_flow_integrity(const MultiLayeredGraph &graph, const std::size_t hype
         const common::SingleReservedSlot current_slot = reserved_slots[current_port][slot_cursors[current_port]];
         const common::FlowNodeID current_flow_id = current_slot.flow_id;
         const graph_structs::Flow current_flow = graph.getFlow(current_flow_id);
-        const common::NetworkNodeID current_port_source = findSourceNodeOfQueue(graph, common::NetworkQueueID(current_port));
+        const common::NetworkNodeID current_port_source = graph.getSourceOf(common::NetworkQueueID(current_port));
         const common::NetworkNodeID current_port_destination = graph.getEgressQueue(common::NetworkQueueID(current_port)).destination;
         if(!flow_trackers.contains(current_flow_id)) {
             // Create new flow tracker
@@ -33,6 +33,29 @@ TEST(GraphCreationTest, LoadNetworkGraphSuccessful)
     }
 }
 
+TEST(GraphCreationTest, SourcesAndIngressQueues)
+{
+    const auto* const network_graph_path = "../../test/test_data/simple_network.txt";
+    const auto graph = io::parseNetworkGraph(network_graph_path).value();
+
+    std::size_t number_of_ingress_queues = 0;
+    for(common::UnderlyingID i = 0; i < graph.getNumberOfNetworkNodes(); ++i) {
+        const auto node_id = common::NetworkNodeID{i};
+        for(const auto& egress_queue : graph.getEgressQueuesOf(node_id)) {
+            ASSERT_EQ(graph.getSourceOf(egress_queue.id), node_id);
+        }
+
+        // full duplex, i.e., every neighbor has a queue towards the node
+        const auto ingress_queues = graph.getIngressQueuesOf(node_id);
+        ASSERT_EQ(ingress_queues.size(), graph.getEgressQueuesOf(node_id).size());
+        for(const auto queue_id : ingress_queues) {
+            ASSERT_EQ(graph.getEgressQueue(queue_id).destination, node_id);
+        }
+        number_of_ingress_queues += ingress_queues.size();
+    }
+    ASSERT_EQ(number_of_ingress_queues, graph.getNumberOfEgressQueues());
+}
+
 TEST(GraphCreationTest, LoadGraphError)
 {
     const auto* const network_graph_path = "../../test/test_data/notExisting.txt";
@@ -85,7 +108,7 @@ TEST(GraphCreationTest, LoadIEEE14busSystem)
     ASSERT_EQ(graph.getNumberOfNetworkNodes(), 36);
     ASSERT_EQ(graph.getNumberOfEgressQueues(), 84);
 
-    for(std::size_t i = 0; i < 36; ++i) {
+    for(common::UnderlyingID i = 0; i < 36; ++i) {
         auto x = graph.getEgressQueuesOf(common::NetworkNodeID{i});
         ASSERT_TRUE(x.size() > 0);
         ASSERT_TRUE(x.size() <= 6);
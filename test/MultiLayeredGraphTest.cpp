@@ -1,5 +1,7 @@
 #include "routing/DijkstraOverlap.h"
 #include <IO/InputParser.h>
+#include <algorithm>
+#include <array>
 #include <graph/GraphStructOperations.h>
 #include <gtest/gtest.h>
 
@@ -19,7 +21,7 @@ TEST(MultiLayeredGraphTest, expandAndShrinkGraph)
     ASSERT_EQ(graph.getNumberOfEgressQueues(), 10);
 
     // expand graph
-    for(std::size_t i = 0; i < 10; ++i) {
+    for(common::UnderlyingID i = 0; i < 10; ++i) {
         graph_structs::Flow f{.id = common::FlowNodeID{i}, .frame_size = 250, .period = 20};
         graph.addFlow(f);
 
@@ -32,12 +34,12 @@ TEST(MultiLayeredGraphTest, expandAndShrinkGraph)
         ASSERT_EQ(graph.getNumberOfEgressQueues(), 10);
         possible_queue_sizes = {0, graph.getNumberOfFlows(), graph.getNumberOfConfigs()};
         for(auto& queue : graph.getEgressQueues()) {
-            ASSERT_TRUE(util::vector_contains(possible_queue_sizes, queue.used_by.size()));
+            ASSERT_TRUE(util::vector_contains(possible_queue_sizes, graph.getUsersOf(queue.id).size()));
         }
     }
 
     // shrink graph
-    for(std::size_t i = 0; i < 5; ++i) {
+    for(common::UnderlyingID i = 0; i < 5; ++i) {
         graph.removeFlow(common::FlowNodeID{i + 5});
 
         ASSERT_EQ(graph.getNumberOfFlows(), 10 - (i + 1));
@@ -47,7 +49,198 @@ TEST(MultiLayeredGraphTest, expandAndShrinkGraph)
 
         possible_queue_sizes = {0, graph.getNumberOfFlows(), graph.getNumberOfConfigs()};
         for(auto& queue : graph.getEgressQueues()) {
-            ASSERT_TRUE(util::vector_contains(possible_queue_sizes, queue.used_by.size()));
+            ASSERT_TRUE(util::vector_contains(possible_queue_sizes, graph.getUsersOf(queue.id).size()));
         }
     }
-}
\ No newline at end of file
+}
+
+TEST(MultiLayeredGraphTest, slotMap)
+{
+    graph_structs::SlotMap<common::FlowNodeID, std::size_t> map;
+    for(common::UnderlyingID i = 0; i < 5; ++i) {
+        map.insert_or_assign(common::FlowNodeID{i}, i * 10);
+    }
+    const auto handle = map.handle(common::FlowNodeID{1});
+
+    ASSERT_TRUE(map.erase(common::FlowNodeID{1}));
+    ASSERT_FALSE(map.erase(common::FlowNodeID{1}));
+    ASSERT_EQ(map.size(), 4);
+    ASSERT_FALSE(map.contains(common::FlowNodeID{1}));
+    ASSERT_THROW((void)map.at(common::FlowNodeID{1}), std::out_of_range);
+    ASSERT_THROW((void)map.at(common::FlowNodeID{42}), std::out_of_range);
+
+    // the last element was moved into the gap
+    for(common::UnderlyingID i : {0, 2, 3, 4}) {
+        ASSERT_EQ(map.at(common::FlowNodeID{i}), i * 10);
+    }
+    for(const auto& [key, value] : map) {
+        ASSERT_EQ(key.get() * 10, value);
+    }
+
+    // a re-inserted key does not revive old handles
+    map.insert_or_assign(common::FlowNodeID{1}, 11);
+    ASSERT_EQ(map.find(handle), nullptr);
+    ASSERT_EQ(*map.find(map.handle(common::FlowNodeID{1})), 11);
+}
+
+TEST(MultiLayeredGraphTest, slotMapShrinks)
+{
+    graph_structs::SlotMap<common::FlowNodeID, std::size_t> map;
+    std::vector<graph_structs::SlotMap<common::FlowNodeID, std::size_t>::Handle> handles;
+
+    // increasing keys of which only the last few are alive, like the configuration IDs
+    for(common::UnderlyingID i = 0; i < 1000; ++i) {
+        map.insert_or_assign(common::FlowNodeID{i}, i);
+        handles.emplace_back(map.handle(common::FlowNodeID{i}));
+        if(i >= 10) {
+            ASSERT_TRUE(map.erase(common::FlowNodeID{i - 10}));
+        }
+        ASSERT_LE(map.slot_count(), 2 * map.size() + 1);
+    }
+    ASSERT_EQ(map.size(), 10);
+    for(common::UnderlyingID i = 990; i < 1000; ++i) {
+        ASSERT_EQ(*map.find(handles[i]), i);
+    }
+
+    // handles of dropped slots do not resolve, even if their key is inserted again below the smallest key
+    ASSERT_FALSE(map.contains(common::FlowNodeID{5}));
+    map.insert_or_assign(common::FlowNodeID{5}, 5);
+    ASSERT_EQ(map.find(handles[5]), nullptr);
+    ASSERT_EQ(map.at(common::FlowNodeID{5}), 5);
+    ASSERT_EQ(map.at(common::FlowNodeID{999}), 999);
+
+    for(common::UnderlyingID i = 990; i < 1000; ++i) {
+        ASSERT_TRUE(map.erase(common::FlowNodeID{i}));
+    }
+    ASSERT_EQ(map.slot_count(), 1);
+    ASSERT_TRUE(map.erase(common::FlowNodeID{5}));
+    ASSERT_EQ(map.slot_count(), 0);
+}
+
+
+TEST(MultiLayeredGraphTest, pathPool)
+{
+    const auto* const network_graph_path = "../../test/test_data/simple_network.txt";
+    auto graph = io::parseNetworkGraph(network_graph_path).value();
+
+    const std::vector path1 = {common::NetworkQueueID{0}, common::NetworkQueueID{1}, common::NetworkQueueID{2}};
+    const std::vector path2 = {common::NetworkQueueID{4}, common::NetworkQueueID{3}};
+
+    // enough configs to grow the pool several times
+    for(common::UnderlyingID i = 0; i < 100; ++i) {
+        graph.addFlow(graph_structs::Flow{.id = common::FlowNodeID{i}, .frame_size = 250, .period = 20});
+        graph_struct_operations::insertConfiguration(graph, common::FlowNodeID{i}, i % 2 == 0 ? path1 : path2);
+    }
+    for(common::UnderlyingID i = 0; i < 80; ++i) {
+        graph.removeFlow(common::FlowNodeID{i});
+    }
+    const auto copy = graph;
+
+    for(const auto* current_graph : std::array<const MultiLayeredGraph*, 2>{&graph, &copy}) {
+        ASSERT_EQ(current_graph->getNumberOfConfigs(), 20);
+        for(const auto& [config_id, config] : current_graph->getConfigurations()) {
+            const auto& expected = config.flow.get() % 2 == 0 ? path1 : path2;
+            ASSERT_TRUE(std::ranges::equal(config.path, expected));
+        }
+    }
+    for(const auto& [config_id, config] : copy.getConfigurations()) {
+        ASSERT_NE(config.path.data(), graph.getConfiguration(config_id).path.data());
+    }
+}
+
+
+TEST(MultiLayeredGraphTest, pathInterning)
+{
+    const auto* const network_graph_path = "../../test/test_data/simple_network.txt";
+    auto graph = io::parseNetworkGraph(network_graph_path).value();
+
+    const std::vector path1 = {common::NetworkQueueID{0}, common::NetworkQueueID{1}, common::NetworkQueueID{2}};
+    const std::vector path2 = {common::NetworkQueueID{4}, common::NetworkQueueID{3}};
+
+    for(common::UnderlyingID i = 0; i < 3; ++i) {
+        graph.addFlow(graph_structs::Flow{.id = common::FlowNodeID{i}, .frame_size = 250, .period = 20});
+        graph_struct_operations::insertConfiguration(graph, common::FlowNodeID{i}, path1);
+    }
+    graph_struct_operations::insertConfiguration(graph, common::FlowNodeID{2}, path2);
+    ASSERT_EQ(graph.getNumberOfConfigs(), 4);
+    ASSERT_EQ(graph.getNumberOfPaths(), 2);
+
+    const auto& config0 = graph.getConfiguration(common::ConfigurationNodeID{0});
+    const auto& config1 = graph.getConfiguration(common::ConfigurationNodeID{1});
+    ASSERT_EQ(config0.path_id.get(), config1.path_id.get());
+    ASSERT_EQ(config0.path.data(), config1.path.data());
+    ASSERT_TRUE(std::ranges::equal(graph.getPath(config0.path_id), path1));
+
+    // the path stays interned as long as a config uses it
+    graph.removeFlow(common::FlowNodeID{0});
+    graph.removeFlow(common::FlowNodeID{1});
+    ASSERT_EQ(graph.getNumberOfPaths(), 2);
+    graph.removeFlow(common::FlowNodeID{2});
+    ASSERT_EQ(graph.getNumberOfPaths(), 0);
+
+    // released path ids are reused
+    graph.addFlow(graph_structs::Flow{.id = common::FlowNodeID{3}, .frame_size = 250, .period = 20});
+    graph_struct_operations::insertConfiguration(graph, common::FlowNodeID{3}, path2);
+    ASSERT_EQ(graph.getNumberOfPaths(), 1);
+    ASSERT_TRUE(std::ranges::equal(graph.getConfiguration(common::ConfigurationNodeID{4}).path, path2));
+}
+
+
+TEST(MultiLayeredGraphTest, usedBy)
+{
+    const auto* const network_graph_path = "../../test/test_data/simple_network.txt";
+    auto graph = io::parseNetworkGraph(network_graph_path).value();
+
+    const std::vector path1 = {common::NetworkQueueID{0}, common::NetworkQueueID{1}, common::NetworkQueueID{2}};
+    const std::vector path2 = {common::NetworkQueueID{4}, common::NetworkQueueID{1}};
+
+    for(common::UnderlyingID i = 0; i < 20; ++i) {
+        graph.addFlow(graph_structs::Flow{.id = common::FlowNodeID{i}, .frame_size = 250, .period = 20});
+        graph_struct_operations::insertConfiguration(graph, common::FlowNodeID{i}, i % 2 == 0 ? path1 : path2);
+    }
+    for(common::UnderlyingID i = 0; i < 20; i += 3) {
+        graph.removeFlow(common::FlowNodeID{i});
+    }
+
+    // every queue is used exactly by the remaining configs routed over it
+    for(const auto& queue : graph.getEgressQueues()) {
+        std::vector<std::size_t> expected;
+        for(const auto& [config_id, config] : graph.getConfigurations()) {
+            if(std::ranges::find(config.path, queue.id) != config.path.end()) {
+                expected.emplace_back(config_id.get());
+            }
+        }
+        std::vector<std::size_t> actual;
+        std::ranges::transform(graph.getUsersOf(queue.id), std::back_inserter(actual), [](auto config_id) { return config_id.get(); });
+        std::ranges::sort(expected);
+        std::ranges::sort(actual);
+        ASSERT_EQ(actual, expected);
+    }
+}
+
+
+TEST(MultiLayeredGraphTest, hyperCycle)
+{
+    const auto* const network_graph_path = "../../test/test_data/simple_network.txt";
+    auto graph = io::parseNetworkGraph(network_graph_path).value();
+    ASSERT_EQ(graph.getHyperCycle(), 1);
+    ASSERT_EQ(graph.getGcdPeriod(), 0);
+
+    graph.addFlow(graph_structs::Flow{.id = common::FlowNodeID{0}, .frame_size = 250, .period = 20});
+    graph.addFlow(graph_structs::Flow{.id = common::FlowNodeID{1}, .frame_size = 250, .period = 30});
+    graph.addFlow(graph_structs::Flow{.id = common::FlowNodeID{2}, .frame_size = 250, .period = 30});
+    ASSERT_EQ(graph.getHyperCycle(), 60);
+    ASSERT_EQ(graph.getGcdPeriod(), 10);
+
+    // another flow with the same period keeps the period alive
+    graph.removeFlow(common::FlowNodeID{1});
+    ASSERT_EQ(graph.getHyperCycle(), 60);
+    graph.removeFlow(common::FlowNodeID{2});
+    ASSERT_EQ(graph.getHyperCycle(), 20);
+    ASSERT_EQ(graph.getGcdPeriod(), 20);
+
+    // overwriting a flow replaces its period
+    graph.addFlow(graph_structs::Flow{.id = common::FlowNodeID{0}, .frame_size = 250, .period = 50});
+    ASSERT_EQ(graph.getHyperCycle(), 50);
+    ASSERT_EQ(graph.getGcdPeriod(), 50);
+}
@@ -16,7 +16,7 @@ inline auto create_dummy_graph_with_flows(const std::vector<std::size_t>& vec) -
 
     routing::DijkstraOverlap navigator;
 
-    std::size_t counter = 0;
+    common::UnderlyingID counter = 0;
     for(const auto period : vec) {
         graph_structs::Flow f{.id = common::FlowNodeID{counter},
                               .frame_size = 125,
@@ -36,7 +36,7 @@ inline auto create_dummy_scenario_with_flows(const std::vector<std::size_t>& vec
 {
     std::vector<io::TimeStep> scenario;
 
-    std::size_t counter = 0;
+    common::UnderlyingID counter = 0;
     io::TimeStep current_step;
     current_step.time = 0;
     for(const auto period : vec) {
@@ -176,7 +176,7 @@ TEST(UtilTest, resultMetricsWithFlows)
 
     EXPECT_EQ(result.size(), expected_utilization_values.size());
 
-    for(std::size_t i = 0; i < result.size(); ++i) {
+    for(common::UnderlyingID i = 0; i < result.size(); ++i) {
         EXPECT_EQ(expected_utilization_values.at(i),
                   result.at(common::NetworkQueueID{i}));
     }
@@ -210,7 +210,7 @@ TEST(UtilTest, MaxQueueSize)
     auto graph = io::parseNetworkGraph(network_graph_path).value();
 
     routing::DijkstraOverlap navigator;
-    for(std::size_t i = 0; i < periods.size(); ++i) {
+    for(common::UnderlyingID i = 0; i < periods.size(); ++i) {
         graph_structs::Flow f{.id = common::FlowNodeID{i},
                               .frame_size = frame_sizes.at(i),
                               .period = periods.at(i),
@@ -260,3 +260,11 @@ TEST(UtilTest, MaxQueueSize)
         EXPECT_EQ(expected_max_queue_sizes.at(time_step.time), actual_max_size);
     }
 }
+
+TEST(UtilTest, checked_narrow)
+{
+    EXPECT_EQ(std::uint32_t{42}, common::checkedNarrow<std::uint32_t>(42, "id"));
+    EXPECT_NO_THROW(common::checkFits<std::uint32_t>(std::numeric_limits<std::uint32_t>::max(), "id"));
+    EXPECT_THROW(common::checkFits<std::uint32_t>(std::size_t{std::numeric_limits<std::uint32_t>::max()} + 1, "id"), std::overflow_error);
+    EXPECT_THROW((void)common::checkedNarrow<std::uint16_t>(70000, "id"), std::overflow_error);
+}
@@ -4,6 +4,9 @@
 #include <testUtil.h>
 #include <util/Constants.h>
 
+// configurations only view their hops, thus the paths have to outlive them
+const std::vector single_hop_path{common::NetworkQueueID{0}};
+
 TEST(UtilizationListSearchTransmissionOpportunities, case_slot_completely_before_arrival)
 {
     constexpr std::size_t hyper_cycle = 2000;
@@ -18,7 +21,7 @@ TEST(UtilizationListSearchTransmissionOpportunities, case_slot_completely_before
 
 
     const auto stream = graph_structs::Flow{.id = common::FlowNodeID{2}, .frame_size = 1250, .period = 1000, .source = common::NetworkNodeID{0}, .destination = common::NetworkNodeID{1}};
-    const auto config = graph_structs::Configuration{.id = common::ConfigurationNodeID{2}, .flow = stream.id, .path = {common::NetworkQueueID{0}}};
+    const auto config = graph_structs::Configuration{.id = common::ConfigurationNodeID{2}, .flow = stream.id, .path = single_hop_path};
 
     const auto reservations = utilizationList.searchTransmissionOpportunities(config, stream, 60, 1000);
     EXPECT_TRUE(reservations.empty());
@@ -38,7 +41,7 @@ TEST(UtilizationListSearchTransmissionOpportunities, case_slot_partially_before_
 
 
     const auto stream = graph_structs::Flow{.id = common::FlowNodeID{2}, .frame_size = 1250, .period = 1000, .source = common::NetworkNodeID{0}, .destination = common::NetworkNodeID{1}};
-    const auto config = graph_structs::Configuration{.id = common::ConfigurationNodeID{2}, .flow = stream.id, .path = {common::NetworkQueueID{0}}};
+    const auto config = graph_structs::Configuration{.id = common::ConfigurationNodeID{2}, .flow = stream.id, .path = single_hop_path};
 
     // remaining slot size is not sufficient to send the frame
     auto reservations = utilizationList.searchTransmissionOpportunities(config, stream, 45, 1000);
@@ -67,7 +70,7 @@ TEST(UtilizationListSearchTransmissionOpportunities, case_slot_at_or_after_arriv
 
 
     const auto stream = graph_structs::Flow{.id = common::FlowNodeID{2}, .frame_size = 1250, .period = 1000, .source = common::NetworkNodeID{0}, .destination = common::NetworkNodeID{1}};
-    const auto config = graph_structs::Configuration{.id = common::ConfigurationNodeID{2}, .flow = stream.id, .path = {common::NetworkQueueID{0}}};
+    const auto config = graph_structs::Configuration{.id = common::ConfigurationNodeID{2}, .flow = stream.id, .path = single_hop_path};
 
     // slot starts at arrival (schedulable)
     auto release_time = 100;
@@ -104,7 +107,7 @@ TEST(UtilizationListSearchTransmissionOpportunities, case_slot_too_small)
 
 
     const auto stream = graph_structs::Flow{.id = common::FlowNodeID{2}, .frame_size = 1250, .period = 1000, .source = common::NetworkNodeID{0}, .destination = common::NetworkNodeID{1}};
-    const auto config = graph_structs::Configuration{.id = common::ConfigurationNodeID{2}, .flow = stream.id, .path = {common::NetworkQueueID{0}}};
+    const auto config = graph_structs::Configuration{.id = common::ConfigurationNodeID{2}, .flow = stream.id, .path = single_hop_path};
 
 
     const auto reservations = utilizationList.searchTransmissionOpportunities(config, stream, 50, hyper_cycle);
@@ -130,7 +133,7 @@ TEST(UtilizationListSearchTransmissionOpportunities, case_deadline_during_slot)
 
 
     const auto stream = graph_structs::Flow{.id = common::FlowNodeID{2}, .frame_size = 1250, .period = 1000, .source = common::NetworkNodeID{0}, .destination = common::NetworkNodeID{1}};
-    const auto config = graph_structs::Configuration{.id = common::ConfigurationNodeID{2}, .flow = stream.id, .path = {common::NetworkQueueID{0}}};
+    const auto config = graph_structs::Configuration{.id = common::ConfigurationNodeID{2}, .flow = stream.id, .path = single_hop_path};
     // deadline during slot, transmission fits before
     auto release_time = 100;
     auto reservations = utilizationList.searchTransmissionOpportunities(config, stream, release_time, 110 + constant::propagation_delay);
@@ -163,7 +166,7 @@ TEST(UtilizationListSearchTransmissionOpportunities, case_deadline_at_slot_end)
 
     constexpr auto deadline = 120;
     const auto stream = graph_structs::Flow{.id = common::FlowNodeID{2}, .frame_size = 1250, .period = 1000, .source = common::NetworkNodeID{0}, .destination = common::NetworkNodeID{1}};
-    const auto config = graph_structs::Configuration{.id = common::ConfigurationNodeID{2}, .flow = stream.id, .path = {common::NetworkQueueID{0}}};
+    const auto config = graph_structs::Configuration{.id = common::ConfigurationNodeID{2}, .flow = stream.id, .path = single_hop_path};
     // Deadline at slot end, transmission fits before
     auto release_time = 110 - constant::propagation_delay;
     auto reservations = utilizationList.searchTransmissionOpportunities(config, stream, release_time, deadline);
@@ -196,7 +199,7 @@ TEST(UtilizationListSearchTransmissionOpportunities, case_perfect_placement)
 
     constexpr auto deadline = 200;
     const auto stream = graph_structs::Flow{.id = common::FlowNodeID{2}, .frame_size = 1250, .period = 1000, .source = common::NetworkNodeID{0}, .destination = common::NetworkNodeID{1}};
-    const auto config = graph_structs::Configuration{.id = common::ConfigurationNodeID{2}, .flow = stream.id, .path = {common::NetworkQueueID{0}}};
+    const auto config = graph_structs::Configuration{.id = common::ConfigurationNodeID{2}, .flow = stream.id, .path = single_hop_path};
 
     constexpr auto release_time = 0;
     const auto reservations = utilizationList.searchTransmissionOpportunities(config, stream, release_time, deadline);
@@ -213,11 +216,11 @@ TEST(UtilizationListSearchTransmissionOpportunities, multipleHops)
     auto utilizationList = common::NetworkUtilizationList{hops, hyper_cycle, 100};
     std::vector<common::NetworkQueueID> path;
     path.reserve(hops);
-    for(std::size_t i = 0; i < hops; ++i) {
+    for(common::UnderlyingID i = 0; i < hops; ++i) {
         path.emplace_back(common::NetworkQueueID{i});
     }
 
-    for(std::size_t i = 0; i < 2; ++i) {
+    for(common::UnderlyingID i = 0; i < 2; ++i) {
         // frame sizes become smaller, so that the later frames catch up with the earlier ones
         const auto stream = graph_structs::Flow{.id = common::FlowNodeID{i}, .frame_size = 1000 / (i + 1), .period = hyper_cycle, .source = common::NetworkNodeID{0}, .destination = common::NetworkNodeID{1}};
         const auto config = graph_structs::Configuration{.id = common::ConfigurationNodeID{i}, .flow = stream.id, .path = path};
@@ -3,6 +3,10 @@
 
 #include <gtest/gtest.h>
 
+// configurations only view their hops, thus the paths have to outlive them
+const std::vector single_hop_path{common::NetworkQueueID{0}};
+const std::vector two_hop_path{common::NetworkQueueID{0}, common::NetworkQueueID{1}};
+
 TEST(UtilizationListTest, init)
 {
     constexpr auto hyper_cycle = std::size_t{100};
@@ -27,13 +31,13 @@ TEST(UtilizationListTest, insertSlots)
 {
     // Flow 0
     graph_structs::Flow f0{.id = common::FlowNodeID{0}, .frame_size = 125, .period = 15};
-    graph_structs::Configuration c0{.id = common::ConfigurationNodeID{0}, .flow = f0.id, .path = std::vector{common::NetworkQueueID{0}}};
+    graph_structs::Configuration c0{.id = common::ConfigurationNodeID{0}, .flow = f0.id, .path = single_hop_path};
     // Flow 1
     graph_structs::Flow f1{.id = common::FlowNodeID{1}, .frame_size = 375, .period = 15};
-    graph_structs::Configuration c1{.id = common::ConfigurationNodeID{1}, .flow = f1.id, .path = std::vector{common::NetworkQueueID{0}}};
+    graph_structs::Configuration c1{.id = common::ConfigurationNodeID{1}, .flow = f1.id, .path = single_hop_path};
     // Flow 2
     graph_structs::Flow f2{.id = common::FlowNodeID{2}, .frame_size = 125, .period = 15};
-    graph_structs::Configuration c2{.id = common::ConfigurationNodeID{2}, .flow = f2.id, .path = std::vector{common::NetworkQueueID{0}}};
+    graph_structs::Configuration c2{.id = common::ConfigurationNodeID{2}, .flow = f2.id, .path = single_hop_path};
 
     common::NetworkUtilizationList utilization_list{2, 15, 15};
     auto success = placement::placeConfigASAP(c0, f0, utilization_list);
@@ -81,7 +85,7 @@ TEST(UtilizationListTest, insertSlots)
     // now test a perfect insert
     // Flow 3, equals the removed Flow 1
     graph_structs::Flow f3{.id = common::FlowNodeID{3}, .frame_size = 375, .period = 15};
-    graph_structs::Configuration c3{.id = common::ConfigurationNodeID{3}, .flow = f3.id, .path = std::vector{common::NetworkQueueID{0}}};
+    graph_structs::Configuration c3{.id = common::ConfigurationNodeID{3}, .flow = f3.id, .path = single_hop_path};
     success = placement::placeConfigASAP(c3, f3, utilization_list);
     ASSERT_TRUE(success);
     ASSERT_EQ(utilization_list.getFreeEgressSlots()[0].size(), 1);
@@ -92,16 +96,15 @@ TEST(UtilizationListTest, reserveSlotsPartialMatchAtSlotEnd)
     constexpr std::size_t hyper_cycle = 20;
     // transmission time of 1, f0-f2 have 5
     const graph_structs::Flow f3_pre{.id = common::FlowNodeID{100}, .frame_size = 125, .period = hyper_cycle};
-    const graph_structs::Configuration c3_pre{.id = common::ConfigurationNodeID{100}, .flow = f3_pre.id, .path = std::vector{common::NetworkQueueID{0}}};
 
     const graph_structs::Flow f0{.id = common::FlowNodeID{0}, .frame_size = 625, .period = hyper_cycle};
-    const graph_structs::Configuration c0{.id = common::ConfigurationNodeID{0}, .flow = f0.id, .path = std::vector{common::NetworkQueueID{0}}};
+    const graph_structs::Configuration c0{.id = common::ConfigurationNodeID{0}, .flow = f0.id, .path = single_hop_path};
 
     const graph_structs::Flow f1{.id = common::FlowNodeID{1}, .frame_size = 625, .period = hyper_cycle};
-    const graph_structs::Configuration c1{.id = common::ConfigurationNodeID{0}, .flow = f1.id, .path = std::vector{common::NetworkQueueID{0}}};
+    const graph_structs::Configuration c1{.id = common::ConfigurationNodeID{0}, .flow = f1.id, .path = single_hop_path};
 
     const graph_structs::Flow f2{.id = common::FlowNodeID{2}, .frame_size = 625, .period = hyper_cycle};
-    const graph_structs::Configuration c2{.id = common::ConfigurationNodeID{0}, .flow = f2.id, .path = std::vector{common::NetworkQueueID{0}}};
+    const graph_structs::Configuration c2{.id = common::ConfigurationNodeID{0}, .flow = f2.id, .path = single_hop_path};
 
 
     common::NetworkUtilizationList utilization_list{2, hyper_cycle, hyper_cycle};
@@ -125,7 +128,7 @@ TEST(UtilizationListTest, reserveSlotsPartialMatchAtSlotEnd)
     EXPECT_EQ(free_slots.at(1).last_free_macro_tick, 10);
 
     const graph_structs::Flow f3{.id = common::FlowNodeID{3}, .frame_size = 125, .period = hyper_cycle / 2};
-    const graph_structs::Configuration c3{.id = common::ConfigurationNodeID{3}, .flow = f3.id, .path = std::vector{common::NetworkQueueID{0}}};
+    const graph_structs::Configuration c3{.id = common::ConfigurationNodeID{3}, .flow = f3.id, .path = single_hop_path};
 
     ASSERT_TRUE(placement::placeConfigASAP(c3, f3, utilization_list));
     ASSERT_EQ(free_slots.size(), 2);
@@ -155,7 +158,7 @@ TEST(UtilizationListTestCornerCases, cornerCases1)
                                  common::FlowNodeID{0}, common::ConfigurationNodeID{0});
 
     const graph_structs::Flow f{.id = common::FlowNodeID{100}, .frame_size = 1250, .period = period};
-    const graph_structs::Configuration c{.id = common::ConfigurationNodeID{100}, .flow = f.id, .path = std::vector{common::NetworkQueueID{0}, common::NetworkQueueID{1}}};
+    const graph_structs::Configuration c{.id = common::ConfigurationNodeID{100}, .flow = f.id, .path = two_hop_path};
 
     // the second sub-cycle is blocked
     const auto sub_cylce_2_transmission_opportunities = utilization_list.searchTransmissionOpportunities(c, f, 50, 100);
@@ -189,7 +192,7 @@ TEST(UtilizationListTestCornerCases, cornerCases2)
                                  common::FlowNodeID{0}, common::ConfigurationNodeID{0});
 
     const graph_structs::Flow f{.id = common::FlowNodeID{100}, .frame_size = 1250, .period = period};
-    const graph_structs::Configuration c{.id = common::ConfigurationNodeID{100}, .flow = f.id, .path = std::vector{common::NetworkQueueID{0}, common::NetworkQueueID{1}}};
+    const graph_structs::Configuration c{.id = common::ConfigurationNodeID{100}, .flow = f.id, .path = two_hop_path};
 
     // the second sub-cycle is blocked
     const auto sub_cylce_2_transmission_opportunities = utilization_list.searchTransmissionOpportunities(c, f, 50, 100);
@@ -232,16 +235,16 @@ TEST(UtilizationListTest, freeSlots)
 {
     // Flow 0
     graph_structs::Flow f0{.id = common::FlowNodeID{0}, .frame_size = 125, .period = 15};
-    graph_structs::Configuration c0{.id = common::ConfigurationNodeID{0}, .flow = f0.id, .path = std::vector{common::NetworkQueueID{0}}};
+    graph_structs::Configuration c0{.id = common::ConfigurationNodeID{0}, .flow = f0.id, .path = single_hop_path};
     // Flow 1
     graph_structs::Flow f1{.id = common::FlowNodeID{1}, .frame_size = 375, .period = 15};
-    graph_structs::Configuration c1{.id = common::ConfigurationNodeID{1}, .flow = f1.id, .path = std::vector{common::NetworkQueueID{0}}};
+    graph_structs::Configuration c1{.id = common::ConfigurationNodeID{1}, .flow = f1.id, .path = single_hop_path};
     // Flow 2
     graph_structs::Flow f2{.id = common::FlowNodeID{2}, .frame_size = 125, .period = 15};
-    graph_structs::Configuration c2{.id = common::ConfigurationNodeID{2}, .flow = f2.id, .path = std::vector{common::NetworkQueueID{0}}};
+    graph_structs::Configuration c2{.id = common::ConfigurationNodeID{2}, .flow = f2.id, .path = single_hop_path};
     // Flow 3
     graph_structs::Flow f3{.id = common::FlowNodeID{3}, .frame_size = 125, .period = 45};
-    graph_structs::Configuration c3{.id = common::ConfigurationNodeID{3}, .flow = f3.id, .path = std::vector{common::NetworkQueueID{0}}};
+    graph_structs::Configuration c3{.id = common::ConfigurationNodeID{3}, .flow = f3.id, .path = single_hop_path};
 
     common::NetworkUtilizationList utilization_list{2, 45, 15};
     auto success = placement::placeConfigASAP(c0, f0, utilization_list);
@@ -305,7 +308,7 @@ TEST(UtilizationListTest, freeSlots)
     // now test a perfect insert
     // Flow 4, equals the removed Flow 1
     graph_structs::Flow f4{.id = common::FlowNodeID{4}, .frame_size = 375, .period = 15};
-    graph_structs::Configuration c4{.id = common::ConfigurationNodeID{4}, .flow = f4.id, .path = std::vector{common::NetworkQueueID{0}}};
+    graph_structs::Configuration c4{.id = common::ConfigurationNodeID{4}, .flow = f4.id, .path = single_hop_path};
     success = placement::placeConfigASAP(c4, f4, utilization_list);
     ASSERT_TRUE(success);
     ASSERT_EQ(utilization_list.getFreeEgressSlots()[0].size(), 3);
@@ -315,9 +318,9 @@ TEST(UtilizationListTest, freeSlotsCornerCaseFirstSlot)
 {
     common::NetworkUtilizationList utilization_list{2, 40, 20};
 
-    for(std::size_t index = 0; index < 7; ++index) {
+    for(common::UnderlyingID index = 0; index < 7; ++index) {
         graph_structs::Flow f{.id = common::FlowNodeID{index}, .frame_size = 250, .period = 20};
-        graph_structs::Configuration c{.id = common::ConfigurationNodeID{index}, .flow = f.id, .path = std::vector{common::NetworkQueueID{0}}};
+        graph_structs::Configuration c{.id = common::ConfigurationNodeID{index}, .flow = f.id, .path = single_hop_path};
         bool success = placement::placeConfigASAP(c, f, utilization_list);
         ASSERT_TRUE(success);
     }
@@ -370,16 +373,16 @@ TEST(UtilizationListTest, freeSlotsCornerCaseLastFreeSlot)
 {
     common::NetworkUtilizationList utilization_list{2, 40, 20};
     // fill up utilization list
-    for(std::size_t index = 0; index < 9; ++index) {
+    for(common::UnderlyingID index = 0; index < 9; ++index) {
         graph_structs::Flow f{.id = common::FlowNodeID{index}, .frame_size = 250, .period = 20};
-        graph_structs::Configuration c{.id = common::ConfigurationNodeID{index}, .flow = f.id, .path = std::vector{common::NetworkQueueID{0}}};
+        graph_structs::Configuration c{.id = common::ConfigurationNodeID{index}, .flow = f.id, .path = single_hop_path};
         bool success = placement::placeConfigASAP(c, f, utilization_list);
         ASSERT_TRUE(success);
     }
 
     // add last flow manually because it wouldn't be schedulable due to the existence of a propagation delay
     graph_structs::Flow f{.id = common::FlowNodeID{9}, .frame_size = 250, .period = 20};
-    graph_structs::Configuration c{.id = common::ConfigurationNodeID{9}, .flow = f.id, .path = std::vector{common::NetworkQueueID{0}}};
+    graph_structs::Configuration c{.id = common::ConfigurationNodeID{9}, .flow = f.id, .path = single_hop_path};
     utilization_list.reserveSlot(common::SlotReservationRequest{common::NetworkQueueID{0}, 18, 20, 0}, f.id, c.id);
     utilization_list.reserveSlot(common::SlotReservationRequest{common::NetworkQueueID{0}, 38, 40, 20}, f.id, c.id);
 
@@ -439,9 +442,9 @@ TEST(UtilizationListTest, freeSlotsMiddleCase)
      */
     common::NetworkUtilizationList utilization_list{2, 40, 20};
     // fill up utilization list
-    for(std::size_t index = 0; index < 9; ++index) {
+    for(common::UnderlyingID index = 0; index < 9; ++index) {
         graph_structs::Flow f{.id = common::FlowNodeID{index}, .frame_size = 250, .period = 20};
-        graph_structs::Configuration c{.id = common::ConfigurationNodeID{index}, .flow = f.id, .path = std::vector{common::NetworkQueueID{0}}};
+        graph_structs::Configuration c{.id = common::ConfigurationNodeID{index}, .flow = f.id, .path = single_hop_path};
         bool success = placement::placeConfigASAP(c, f, utilization_list);
         ASSERT_TRUE(success);
     }
@@ -506,9 +509,9 @@ TEST(UtilizationListTest, freeMultipleSlots)
 {
     common::NetworkUtilizationList utilization_list{2, 40, 20};
 
-    for(std::size_t index = 0; index < 5; ++index) {
+    for(common::UnderlyingID index = 0; index < 5; ++index) {
         graph_structs::Flow f{.id = common::FlowNodeID{index}, .frame_size = 250, .period = 20};
-        graph_structs::Configuration c{.id = common::ConfigurationNodeID{index}, .flow = f.id, .path = std::vector{common::NetworkQueueID{0}}};
+        graph_structs::Configuration c{.id = common::ConfigurationNodeID{index}, .flow = f.id, .path = single_hop_path};
         bool success = placement::placeConfigASAP(c, f, utilization_list);
         ASSERT_TRUE(success);
     }
@@ -572,7 +575,7 @@ TEST(UtilizationListTest, balancedPlacement2)
 
     common::NetworkUtilizationList utilization_list{2, 800, 100};
     std::vector<graph_structs::Flow> flows;
-    for(std::size_t i = 0; i < 50; ++i) {
+    for(common::UnderlyingID i = 0; i < 50; ++i) {
         flows.emplace_back(graph_structs::Flow{.id = common::FlowNodeID{i}, .frame_size = 250, .period = 200});
     }
 
@@ -612,7 +615,7 @@ TEST(UtilizationListTest, balancedPlacement3)
 
     common::NetworkUtilizationList utilization_list{2, 800, 100};
     std::vector<graph_structs::Flow> flows;
-    for(std::size_t i = 0; i < 50; ++i) {
+    for(common::UnderlyingID i = 0; i < 50; ++i) {
         graph_structs::Flow f{.id = common::FlowNodeID{i}, .frame_size = 250, .period = 200};
         graph_structs::Configuration c{.id = common::ConfigurationNodeID{f.id.get()}, .flow = f.id, .path = path};
         auto success = placement::placeConfigBalanced(c, f, utilization_list);
@@ -620,7 +623,7 @@ TEST(UtilizationListTest, balancedPlacement3)
     }
 
     std::vector<graph_structs::Flow> flows2;
-    for(std::size_t i = 0; i < 10; ++i) {
+    for(common::UnderlyingID i = 0; i < 10; ++i) {
         graph_structs::Flow f{.id = common::FlowNodeID{50 + i}, .frame_size = 125, .period = 100};
         graph_structs::Configuration c{.id = common::ConfigurationNodeID{f.id.get()}, .flow = f.id, .path = path};
         bool success = placement::placeConfigBalanced(c, f, utilization_list);
@@ -671,3 +674,34 @@ TEST(UtilizationListTest, sortReserved)
     EXPECT_EQ(reserved[0].at(5).start_time, 900);
     EXPECT_EQ(reserved[0].at(5).next_slot_start, 901);
 }
+
+TEST(UtilizationListTest, reservationLookup)
+{
+    common::NetworkUtilizationList utilization_list{2, 100, 100};
+    const auto flow_a = common::FlowNodeID{0};
+    const auto flow_b = common::FlowNodeID{1};
+    const auto link = common::NetworkQueueID{0};
+
+    // reserve out of order: a at 60, b at 20, a at 10
+    ASSERT_TRUE(utilization_list.reserveSlot({.egress_queue = link, .start_time = 60, .next_slot_start = 70, .arrival_time = 60}, flow_a, common::ConfigurationNodeID{0}));
+    ASSERT_TRUE(utilization_list.reserveSlot({.egress_queue = link, .start_time = 20, .next_slot_start = 25, .arrival_time = 20}, flow_b, common::ConfigurationNodeID{1}));
+    ASSERT_TRUE(utilization_list.reserveSlot({.egress_queue = link, .start_time = 10, .next_slot_start = 20, .arrival_time = 10}, flow_a, common::ConfigurationNodeID{0}));
+
+    ASSERT_EQ(std::ranges::distance(utilization_list.getReservedSlotsOf(link, flow_a)), 2);
+    ASSERT_EQ(std::ranges::distance(utilization_list.getReservedSlotsOf(link, flow_b)), 1);
+    ASSERT_TRUE(std::ranges::empty(utilization_list.getReservedSlotsOf(common::NetworkQueueID{1}, flow_a)));
+
+    // free slots: [0, 9], [25, 59], [70, 99]
+    auto latest = utilization_list.findLatestFreeSlot(link, 65, 5);
+    ASSERT_TRUE(latest.has_value());
+    ASSERT_EQ(latest->start_time, 25);
+    // [0, 9] is too short
+    ASSERT_FALSE(utilization_list.findLatestFreeSlot(link, 20, 10).has_value());
+    latest = utilization_list.findLatestFreeSlot(link, 99, 29);
+    ASSERT_TRUE(latest.has_value());
+    ASSERT_EQ(latest->start_time, 70);
+
+    utilization_list.removeConfigs({flow_a});
+    ASSERT_TRUE(std::ranges::empty(utilization_list.getReservedSlotsOf(link, flow_a)));
+    ASSERT_EQ(std::ranges::distance(utilization_list.getReservedSlotsOf(link, flow_b)), 1);
+}
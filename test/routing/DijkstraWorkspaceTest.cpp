@@ -0,0 +1,172 @@
+#include "IO/InputParser.h"
+#include <gtest/gtest.h>
+#include <random>
+#include <routing/DijkstraWorkspace.h>
+
+class DijkstraWorkspaceTest : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        const auto* const network_graph_path = "../../test/test_data/graph_even_random_25.txt";
+        graph = io::parseNetworkGraph(network_graph_path).value();
+    }
+
+    /**
+     * sets a random weight in [1, max_weight] on every egress queue
+     * @param max_weight
+     * @param seed
+     */
+    auto setRandomWeights(const std::int64_t max_weight, const unsigned seed) -> void
+    {
+        std::mt19937 generator(seed);
+        std::uniform_int_distribution<std::int64_t> weight_distribution(1, max_weight);
+        workspace.resetWeights();
+        for(const auto& egress_queue : graph.getEgressQueues()) {
+            workspace.setWeight(egress_queue.id, weight_distribution(generator));
+        }
+    }
+
+    /**
+     * Bellman-Ford with the weights of the workspace, skipping removed edges
+     * @param source
+     * @return the distance to every node, std::nullopt if the node is not reachable
+     */
+    [[nodiscard]] auto referenceDistances(const common::NetworkNodeID source) const -> std::vector<std::optional<std::int64_t>>
+    {
+        std::vector<std::optional<std::int64_t>> distances(graph.getNumberOfNetworkNodes());
+        distances[source.get()] = 0;
+        for(std::size_t round = 1; round < graph.getNumberOfNetworkNodes(); ++round) {
+            for(const auto& egress_queue : graph.getEgressQueues()) {
+                const auto& source_distance = distances[graph.getSourceOf(egress_queue.id).get()];
+                if(workspace.isRemoved(egress_queue.id) or not source_distance.has_value()) {
+                    continue;
+                }
+                auto& destination_distance = distances[egress_queue.destination.get()];
+                const auto distance = source_distance.value() + workspace.getWeight(egress_queue.id);
+                if(not destination_distance.has_value() or distance < destination_distance.value()) {
+                    destination_distance = distance;
+                }
+            }
+        }
+        return distances;
+    }
+
+    /**
+     * checks that path leads from source to destination without removed edges
+     * @param path
+     * @param source
+     * @param destination
+     * @return the sum of the weights of path
+     */
+    [[nodiscard]] auto pathCost(const std::vector<common::NetworkQueueID>& path, const common::NetworkNodeID source,
+                                const common::NetworkNodeID destination) const -> std::int64_t
+    {
+        std::int64_t cost = 0;
+        auto node = source;
+        for(const auto hop : path) {
+            EXPECT_EQ(graph.getSourceOf(hop), node);
+            EXPECT_FALSE(workspace.isRemoved(hop));
+            cost += workspace.getWeight(hop);
+            node = graph.getEgressQueue(hop).destination;
+        }
+        EXPECT_EQ(node, destination);
+        return cost;
+    }
+
+    /**
+     * compares the shortest paths between all pairs of nodes with the reference distances
+     */
+    auto expectShortestPaths() -> void
+    {
+        for(common::UnderlyingID source = 0; source < graph.getNumberOfNetworkNodes(); ++source) {
+            const auto expected_distances = referenceDistances(common::NetworkNodeID{source});
+            for(common::UnderlyingID destination = 0; destination < graph.getNumberOfNetworkNodes(); ++destination) {
+                const auto path = workspace.findShortestPath(common::NetworkNodeID{source}, common::NetworkNodeID{destination}, graph);
+                ASSERT_EQ(path.has_value(), expected_distances[destination].has_value()) << source << " -> " << destination;
+                if(path.has_value()) {
+                    ASSERT_EQ(pathCost(path.value(), common::NetworkNodeID{source}, common::NetworkNodeID{destination}),
+                              expected_distances[destination].value())
+                        << source << " -> " << destination;
+                }
+            }
+        }
+    }
+
+    MultiLayeredGraph graph;
+    routing::DijkstraWorkspace workspace;
+};
+
+TEST_F(DijkstraWorkspaceTest, unit_weights)
+{
+    expectShortestPaths();
+    ASSERT_TRUE(workspace.shortestPath(common::NetworkNodeID{3}, common::NetworkNodeID{3}, graph).empty());
+}
+
+TEST_F(DijkstraWorkspaceTest, small_weights)
+{
+    // weights up to 64 are searched with the bucket queue
+    for(unsigned seed = 0; seed < 5; ++seed) {
+        setRandomWeights(8, seed);
+        expectShortestPaths();
+        setRandomWeights(64, seed);
+        expectShortestPaths();
+    }
+}
+
+TEST_F(DijkstraWorkspaceTest, large_weights)
+{
+    // larger weights are searched with the binary heap
+    for(unsigned seed = 0; seed < 5; ++seed) {
+        setRandomWeights(65, seed);
+        expectShortestPaths();
+        setRandomWeights(100000, seed);
+        expectShortestPaths();
+    }
+}
+
+TEST_F(DijkstraWorkspaceTest, reset_weights)
+{
+    setRandomWeights(100000, 0);
+    workspace.resetWeights();
+    for(const auto& egress_queue : graph.getEgressQueues()) {
+        ASSERT_EQ(workspace.getWeight(egress_queue.id), 1);
+        ASSERT_FALSE(workspace.hasWeight(egress_queue.id));
+    }
+    expectShortestPaths();
+}
+
+TEST_F(DijkstraWorkspaceTest, removed_edges)
+{
+    // both directions of the search skip removed edges, some pairs become unreachable
+    for(unsigned seed = 0; seed < 5; ++seed) {
+        for(const auto max_weight : {std::int64_t{8}, std::int64_t{100000}}) {
+            setRandomWeights(max_weight, seed);
+            std::mt19937 generator(seed);
+            for(const auto& egress_queue : graph.getEgressQueues()) {
+                if(generator() % 3 == 0) {
+                    workspace.removeEdge(egress_queue.id);
+                }
+            }
+            expectShortestPaths();
+        }
+    }
+}
+
+TEST_F(DijkstraWorkspaceTest, unreachable_destination)
+{
+    constexpr auto source = common::NetworkNodeID{0};
+    constexpr auto destination = common::NetworkNodeID{20};
+    for(const auto in_link : graph.getIngressQueuesOf(destination)) {
+        workspace.removeEdge(in_link);
+        ASSERT_TRUE(workspace.isRemoved(in_link));
+    }
+
+    ASSERT_FALSE(workspace.findShortestPath(source, destination, graph).has_value());
+    ASSERT_THROW((void)workspace.shortestPath(source, destination, graph), std::runtime_error);
+    // the destination can still reach the source
+    ASSERT_TRUE(workspace.findShortestPath(destination, source, graph).has_value());
+
+    workspace.resetWeights();
+    ASSERT_TRUE(workspace.findShortestPath(source, destination, graph).has_value());
+}
@@ -0,0 +1,93 @@
+#include "IO/InputParser.h"
+#include <gtest/gtest.h>
+#include <routing/DijkstraOverlap.h>
+#include <routing/EdgeDisjointNavigation.h>
+
+class EdgeDisjointNavigationTest : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        const auto* const network_graph_path = "../../test/test_data/graph_even_random_25.txt";
+        graph = io::parseNetworkGraph(network_graph_path).value();
+    }
+
+    [[nodiscard]] static auto sharedQueues(const std::vector<common::NetworkQueueID>& lhs, const std::vector<common::NetworkQueueID>& rhs) -> std::size_t
+    {
+        return static_cast<std::size_t>(std::ranges::count_if(lhs, [&](const auto hop) { return std::ranges::find(rhs, hop) != rhs.end(); }));
+    }
+
+    MultiLayeredGraph graph;
+    routing::EdgeDisjointNavigation navigator;
+};
+
+TEST_F(EdgeDisjointNavigationTest, name)
+{
+    ASSERT_EQ(navigator.name(), "EdgeDisjoint");
+}
+
+TEST_F(EdgeDisjointNavigationTest, calculateShortestRoute)
+{
+    routing::DijkstraOverlap dijkstra_overlap;
+    for(common::UnderlyingID destination = 1; destination < graph.getNumberOfNetworkNodes(); ++destination) {
+        const auto routes = navigator.findRoutes(common::NetworkNodeID{0}, common::NetworkNodeID{destination}, graph, 1);
+        ASSERT_EQ(routes.size(), 1);
+        ASSERT_EQ(routes[0].size(), dijkstra_overlap.findRoutes(common::NetworkNodeID{0}, common::NetworkNodeID{destination}, graph, 1)[0].size());
+    }
+}
+
+TEST_F(EdgeDisjointNavigationTest, calculateDisjointRoutes)
+{
+    constexpr auto source = common::NetworkNodeID{0};
+    constexpr auto destination = common::NetworkNodeID{20};
+    // the minimum cut between both nodes has 5 links
+    constexpr std::size_t number_of_disjoint_routes = 5;
+
+    const auto routes = navigator.findRoutes(source, destination, graph, number_of_disjoint_routes);
+    ASSERT_EQ(routes.size(), number_of_disjoint_routes);
+    for(std::size_t i = 0; i < routes.size(); ++i) {
+        // each route is a path from source to destination
+        auto node = source;
+        for(const auto hop : routes[i]) {
+            ASSERT_EQ(graph.getSourceOf(hop), node);
+            node = graph.getEgressQueue(hop).destination;
+        }
+        ASSERT_EQ(node, destination);
+
+        for(std::size_t j = i + 1; j < routes.size(); ++j) {
+            ASSERT_EQ(sharedQueues(routes[i], routes[j]), 0);
+        }
+        if(i > 0) {
+            ASSERT_LE(routes[i - 1].size(), routes[i].size());
+        }
+    }
+}
+
+TEST_F(EdgeDisjointNavigationTest, calculateMoreRoutesThanDisjointOnes)
+{
+    const auto routes = navigator.findRoutes(common::NetworkNodeID{0}, common::NetworkNodeID{20}, graph, 7);
+    ASSERT_EQ(routes.size(), 7);
+    for(std::size_t i = 0; i < routes.size(); ++i) {
+        for(std::size_t j = i + 1; j < routes.size(); ++j) {
+            ASSERT_NE(routes[i], routes[j]);
+        }
+    }
+}
+
+TEST_F(EdgeDisjointNavigationTest, calculateOverlappingRoutes)
+{
+    // the end devices 0 and 3 have a single link, thus the two routes share them
+    const auto simple_graph = io::parseNetworkGraph("../../test/test_data/simple_network.txt").value();
+    const auto routes = navigator.findRoutes(common::NetworkNodeID{0}, common::NetworkNodeID{3}, simple_graph, 3);
+    ASSERT_EQ(routes.size(), 2);
+    ASSERT_EQ(routes[0].size(), 3);
+    ASSERT_EQ(routes[1].size(), 4);
+    ASSERT_EQ(sharedQueues(routes[0], routes[1]), 2);
+}
+
+TEST_F(EdgeDisjointNavigationTest, calculateNoHopRoutes)
+{
+    const auto routes_1_to_1 = navigator.findRoutes(common::NetworkNodeID{1}, common::NetworkNodeID{1}, graph, 3);
+    ASSERT_EQ(routes_1_to_1.size(), 1);
+    ASSERT_EQ(routes_1_to_1[0].size(), 0);
+}
@@ -1,8 +1,14 @@
 #include "../testUtil.h"
 #include "IO/InputParser.h"
+#include "routing/CachedNavigation.h"
+#include "routing/CongestionAwareNavigation.h"
 #include "routing/DijkstraOverlap.h"
+#include "routing/PrecomputedNavigation.h"
+#include <filesystem>
+#include <fstream>
 #include <gtest/gtest.h>
 #include <routing/KShortest.h>
+#include <thread>
 
 class RoutingTest : public testing::Test
 {
@@ -43,6 +49,196 @@ TEST_F(RoutingTest, trivial_graph_ask_for_too_many_routes)
     ASSERT_EQ(dijkstraOverlapRoutes, kShortestRoutes);
 }
 
+TEST_F(RoutingTest, cached_navigation)
+{
+    const auto graph = io::parseNetworkGraph("../../test/test_data/simple_network.txt").value();
+
+    constexpr auto source = common::NetworkNodeID{0};
+    constexpr auto destination = common::NetworkNodeID{3};
+
+    routing::CachedNavigation cached_navigator(std::make_shared<routing::DijkstraOverlap>());
+    ASSERT_EQ(cached_navigator.name(), dijkstraOverlapNavigator_.name());
+
+    const auto expected_routes = dijkstraOverlapNavigator_.findRoutes(source, destination, graph, 2);
+    ASSERT_EQ(cached_navigator.findRoutes(source, destination, graph, 2), expected_routes);
+    ASSERT_EQ(cached_navigator.findRoutes(source, destination, graph, 2), expected_routes);
+    ASSERT_EQ(cached_navigator.getNumberOfCacheHits(), 1);
+    ASSERT_EQ(cached_navigator.getNumberOfCacheMisses(), 1);
+
+    // a different number of candidates is a different entry
+    ASSERT_EQ(cached_navigator.findRoutes(source, destination, graph, 1).size(), 1);
+    ASSERT_EQ(cached_navigator.getNumberOfCacheMisses(), 2);
+}
+
+TEST_F(RoutingTest, cached_navigation_concurrent)
+{
+    const auto graph = io::parseNetworkGraph("../../test/test_data/graph_even_random_25.txt").value();
+    const auto number_of_nodes = graph.getNumberOfNetworkNodes();
+
+    routing::CachedNavigation cached_navigator(std::make_shared<routing::DijkstraOverlap>());
+    std::vector<std::vector<std::vector<std::vector<common::NetworkQueueID>>>> routes_per_thread(4);
+    {
+        std::vector<std::jthread> workers;
+        for(auto& routes : routes_per_thread) {
+            workers.emplace_back([&] {
+                for(common::UnderlyingID source = 0; source < number_of_nodes; ++source) {
+                    routes.emplace_back(cached_navigator.findRoutes(common::NetworkNodeID{source}, common::NetworkNodeID{0}, graph, 3));
+                }
+            });
+        }
+    }
+
+    for(common::UnderlyingID source = 0; source < number_of_nodes; ++source) {
+        const auto expected_routes = dijkstraOverlapNavigator_.findRoutes(common::NetworkNodeID{source}, common::NetworkNodeID{0}, graph, 3);
+        for(const auto& routes : routes_per_thread) {
+            ASSERT_EQ(routes[source], expected_routes);
+        }
+    }
+    // concurrent misses on the same pair are all counted
+    ASSERT_GE(cached_navigator.getNumberOfCacheMisses(), number_of_nodes);
+    ASSERT_EQ(cached_navigator.getNumberOfCacheHits() + cached_navigator.getNumberOfCacheMisses(), routes_per_thread.size() * number_of_nodes);
+}
+
+TEST_F(RoutingTest, precomputed_navigation)
+{
+    const auto graph = io::parseNetworkGraph("../../test/test_data/simple_network.txt").value();
+
+    constexpr auto source = common::NetworkNodeID{0};
+    constexpr auto destination = common::NetworkNodeID{3};
+    const auto navigator = std::make_shared<routing::DijkstraOverlap>();
+
+    auto precomputed_navigator = routing::PrecomputedNavigation::precompute(navigator, graph, 2, 2);
+    ASSERT_EQ(precomputed_navigator.name(), dijkstraOverlapNavigator_.name());
+    // nodes 0 and 3 are the only nodes with a single neighbor
+    ASSERT_EQ(precomputed_navigator.getNumberOfEndDevices(), 2);
+
+    const auto expected_routes = dijkstraOverlapNavigator_.findRoutes(source, destination, graph, 2);
+    ASSERT_EQ(precomputed_navigator.findRoutes(source, destination, graph, 2), expected_routes);
+    ASSERT_EQ(precomputed_navigator.findRoutes(destination, source, graph, 2),
+              dijkstraOverlapNavigator_.findRoutes(destination, source, graph, 2));
+    // not in the table
+    ASSERT_EQ(precomputed_navigator.findRoutes(common::NetworkNodeID{1}, destination, graph, 2),
+              dijkstraOverlapNavigator_.findRoutes(common::NetworkNodeID{1}, destination, graph, 2));
+    ASSERT_EQ(precomputed_navigator.findRoutes(source, destination, graph, 1).size(), 1);
+
+    // store and map the table again
+    const auto route_table_path = (std::filesystem::temp_directory_path() / "precomputed_navigation_test.bin").string();
+    ASSERT_TRUE(precomputed_navigator.save(route_table_path));
+    auto loaded_navigator = routing::PrecomputedNavigation::load(route_table_path, navigator, graph, 2);
+    ASSERT_TRUE(loaded_navigator.has_value());
+    ASSERT_EQ(loaded_navigator->getNumberOfEndDevices(), 2);
+    ASSERT_EQ(loaded_navigator->findRoutes(source, destination, graph, 2), expected_routes);
+
+    // tables of another number of candidates or another network are rejected
+    ASSERT_FALSE(routing::PrecomputedNavigation::load(route_table_path, navigator, graph, 3).has_value());
+    const auto other_graph = io::parseNetworkGraph("../../test/test_data/graph_even_random_25.txt").value();
+    ASSERT_FALSE(routing::PrecomputedNavigation::load(route_table_path, navigator, other_graph, 2).has_value());
+    // tables of another routing algorithm are rejected
+    ASSERT_FALSE(routing::PrecomputedNavigation::load(route_table_path, std::make_shared<routing::KShortest>(), graph, 2).has_value());
+
+    // a corrupt route offset of a table with the expected size is rejected
+    {
+        std::fstream route_table(route_table_path, std::ios::binary | std::ios::in | std::ios::out);
+        const auto devices_size = (2 * sizeof(common::UnderlyingID) + 7) / 8 * 8;
+        route_table.seekp(static_cast<std::streamoff>(10 * sizeof(std::uint64_t) + devices_size + sizeof(std::uint64_t)));
+        const std::uint64_t corrupt_offset = 1000;
+        route_table.write(reinterpret_cast<const char*>(&corrupt_offset), sizeof(corrupt_offset));
+    }
+    ASSERT_FALSE(routing::PrecomputedNavigation::load(route_table_path, navigator, graph, 2).has_value());
+    std::filesystem::remove(route_table_path);
+}
+
+TEST_F(RoutingTest, precomputed_navigation_unreachable_devices)
+{
+    // the simple network and a second component 5 - 6
+    const auto network_path = (std::filesystem::temp_directory_path() / "precomputed_navigation_test.txt").string();
+    {
+        std::ifstream simple_network("../../test/test_data/simple_network.txt");
+        std::ofstream network(network_path);
+        network << simple_network.rdbuf() << "\n5\t6\n";
+    }
+    const auto graph = io::parseNetworkGraph(network_path).value();
+    std::filesystem::remove(network_path);
+
+    auto precomputed_navigator = routing::PrecomputedNavigation::precompute(std::make_shared<routing::DijkstraOverlap>(), graph, 2, 2);
+    ASSERT_EQ(precomputed_navigator.getNumberOfEndDevices(), 4);
+    ASSERT_EQ(precomputed_navigator.findRoutes(common::NetworkNodeID{0}, common::NetworkNodeID{3}, graph, 2),
+              dijkstraOverlapNavigator_.findRoutes(common::NetworkNodeID{0}, common::NetworkNodeID{3}, graph, 2));
+    ASSERT_EQ(precomputed_navigator.findRoutes(common::NetworkNodeID{5}, common::NetworkNodeID{6}, graph, 2).size(), 1);
+    // only requesting an unreachable pair fails
+    ASSERT_THROW((void)precomputed_navigator.findRoutes(common::NetworkNodeID{0}, common::NetworkNodeID{6}, graph, 2), std::runtime_error);
+}
+
+TEST_F(RoutingTest, congestion_aware_navigation)
+{
+    const auto graph = io::parseNetworkGraph("../../test/test_data/simple_network.txt").value();
+
+    constexpr auto source = common::NetworkNodeID{0};
+    constexpr auto destination = common::NetworkNodeID{3};
+
+    routing::CongestionAwareNavigation navigator;
+    ASSERT_EQ(navigator.name(), "CongestionAware");
+
+    // without load, the routes equal the ones of DijkstraOverlap
+    common::NetworkUtilizationList utilization(graph.getNumberOfEgressQueues(), 100, 100);
+    navigator.updateUtilization(graph, utilization);
+    ASSERT_EQ(navigator.findRoutes(source, destination, graph, 2), dijkstraOverlapNavigator_.findRoutes(source, destination, graph, 2));
+    ASSERT_EQ(navigator.findRoutes(source, destination, graph, 1).front().size(), 3);
+
+    // reserve most of the link 1 -> 2, so that the detour via node 4 is preferred
+    const auto link_1_to_2 = std::ranges::find(graph.getEgressQueuesOf(common::NetworkNodeID{1}), common::NetworkNodeID{2}, &graph_structs::EgressQueue::destination)->id;
+    utilization.reserveSlot(common::SlotReservationRequest{.egress_queue = link_1_to_2, .start_time = 0, .next_slot_start = 80, .arrival_time = 0},
+                            common::FlowNodeID{0}, common::ConfigurationNodeID{0});
+    navigator.updateUtilization(graph, utilization);
+
+    const auto routes = navigator.findRoutes(source, destination, graph, 2);
+    ASSERT_EQ(routes.size(), 2);
+    ASSERT_EQ(routes[0].size(), 4);
+    ASSERT_FALSE(util::vector_contains(routes[0], link_1_to_2));
+    ASSERT_EQ(routes[1].size(), 3);
+}
+
+TEST_F(RoutingTest, route_generator)
+{
+    const auto graph = io::parseNetworkGraph("../../test/test_data/graph_even_random_25.txt").value();
+
+    constexpr auto source = common::NetworkNodeID{0};
+    constexpr auto destination = common::NetworkNodeID{20};
+
+    routing::CachedNavigation cached_navigator(std::make_shared<routing::KShortest>());
+    routing::CongestionAwareNavigation congestion_aware_navigator;
+    std::vector<routing::AbstractNavigation*> navigators{&kShortestNavigator_, &dijkstraOverlapNavigator_, &cached_navigator, &congestion_aware_navigator};
+    for(auto* navigator : navigators) {
+        // the generator yields the routes of findRoutes one by one
+        const auto expected_routes = navigator->findRoutes(source, destination, graph, 5);
+        ASSERT_EQ(expected_routes.size(), 5);
+        auto generator = navigator->createRouteGenerator(source, destination);
+        for(const auto& expected_route : expected_routes) {
+            ASSERT_EQ(generator->next(graph), expected_route) << navigator->name();
+        }
+    }
+
+    // generators of different flows can be interleaved
+    navigators = {&kShortestNavigator_, &dijkstraOverlapNavigator_};
+    for(auto* navigator : navigators) {
+        auto first_generator = navigator->createRouteGenerator(source, destination);
+        auto second_generator = navigator->createRouteGenerator(destination, source);
+        const auto first_routes = navigator->findRoutes(source, destination, graph, 3);
+        const auto second_routes = navigator->findRoutes(destination, source, graph, 3);
+        for(std::size_t i = 0; i < 3; ++i) {
+            ASSERT_EQ(first_generator->next(graph), first_routes[i]) << navigator->name();
+            ASSERT_EQ(second_generator->next(graph), second_routes[i]) << navigator->name();
+        }
+    }
+
+    // simple_network has two routes between 0 and 3
+    const auto simple_graph = io::parseNetworkGraph("../../test/test_data/simple_network.txt").value();
+    auto exhausted_generator = kShortestNavigator_.createRouteGenerator(source, common::NetworkNodeID{3});
+    ASSERT_TRUE(exhausted_generator->next(simple_graph).has_value());
+    ASSERT_TRUE(exhausted_generator->next(simple_graph).has_value());
+    ASSERT_FALSE(exhausted_generator->next(simple_graph).has_value());
+}
+
 TEST_F(RoutingTest, check_for_expected_different_results)
 {
     auto graph = io::parseNetworkGraph("../../test/test_data/routing_graph_2.txt").value();
@@ -0,0 +1,192 @@
+#include "IO/InputParser.h"
+#include "graph/GraphStructOperations.h"
+#include "routing/DijkstraOverlap.h"
+#include "solver/scheduler/EarliestDeadlineFirst.h"
+#include "solver/scheduler/FirstFit.h"
+#include "solver/scheduler/HierarchicalHeuristicScheduling.h"
+#include "solver/scheduler/Portfolio.h"
+
+#include <gtest/gtest.h>
+#include <random>
+#include <testUtil.h>
+#include <thread>
+
+class ConcurrentPlanningTest : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        const auto* const network_graph_path = "../../test/test_data/graph_even_random_25.txt";
+        graph = io::parseNetworkGraph(network_graph_path).value();
+    }
+
+    auto insertTraffic(const std::size_t number_of_flows) -> robin_hood::unordered_set<common::FlowNodeID>
+    {
+        routing::DijkstraOverlap navigator;
+        const auto next_id = static_cast<common::UnderlyingID>(graph.getNumberOfFlows());
+        std::mt19937 generator(next_id);
+        const auto number_of_nodes = static_cast<common::UnderlyingID>(graph.getNumberOfNetworkNodes());
+
+        robin_hood::unordered_set<common::FlowNodeID> inserted_flows;
+        for(common::UnderlyingID i = next_id; i < next_id + number_of_flows; ++i) {
+            const auto flow_id = common::FlowNodeID{i};
+            const auto source = common::NetworkNodeID{static_cast<common::UnderlyingID>(generator() % number_of_nodes)};
+            const auto destination = common::NetworkNodeID{static_cast<common::UnderlyingID>((source.get() + 1 + generator() % (number_of_nodes - 1)) % number_of_nodes)};
+
+            graph.addFlow(graph_structs::Flow{
+                .id = flow_id,
+                .frame_size = 500 + (generator() % 4) * 500,
+                .period = i % 2 == 0 ? std::size_t{500} : std::size_t{1000},
+                .source = source,
+                .destination = destination});
+            for(const auto& route : navigator.findRoutes(source, destination, graph, 2)) {
+                graph_struct_operations::insertConfiguration(graph, flow_id, route);
+            }
+            inserted_flows.insert(flow_id);
+        }
+        return inserted_flows;
+    }
+
+    struct PlanningResult
+    {
+        solver::solutionSet defensive_solution;
+        common::NetworkUtilizationList defensive_utilization;
+        solver::solutionSet offensive_solution;
+        common::NetworkUtilizationList offensive_utilization;
+    };
+
+    /**
+     * schedules the first half of the flows, then plans the second half defensively and offensively, like a time step
+     * of the ScenarioManager
+     * @param defensive_solver
+     * @param offensive_solver defensive_solver for the sequential planning, a clone for the concurrent one
+     * @param concurrent
+     * @return
+     */
+    auto plan(solver::AbstractScheduler& defensive_solver, solver::AbstractScheduler& offensive_solver, const bool concurrent) -> PlanningResult
+    {
+        PlanningResult result{.defensive_utilization = common::NetworkUtilizationList(graph.getNumberOfEgressQueues(), 1000, 500),
+                              .offensive_utilization = common::NetworkUtilizationList(graph.getNumberOfEgressQueues(), 1000, 500)};
+
+        robin_hood::unordered_set<common::FlowNodeID> active_f;
+        for(const auto& flow_id : defensive_solver.solve(graph, {}, first_step, result.defensive_utilization) | std::views::keys) {
+            active_f.insert(flow_id);
+        }
+
+        const auto offensive_planning = [&] {
+            result.offensive_solution = offensive_solver.solve(graph, active_f, second_step, result.offensive_utilization);
+        };
+        std::jthread offensive_thread;
+        if(concurrent) {
+            offensive_thread = std::jthread(offensive_planning);
+        }
+        result.defensive_solution = defensive_solver.solve(graph, {}, second_step, result.defensive_utilization);
+        if(concurrent) {
+            offensive_thread.join();
+        } else {
+            offensive_planning();
+        }
+
+        check_reservation_overlaps(result.defensive_utilization);
+        check_reservation_overlaps(result.offensive_utilization);
+        return result;
+    }
+
+    auto expectConcurrentMatchesSequential(solver::AbstractScheduler& solver) -> void
+    {
+        const auto sequential = plan(solver, solver, false);
+        auto offensive_solver = solver.clone();
+        ASSERT_EQ(offensive_solver->name(), solver.name());
+        const auto concurrent = plan(solver, *offensive_solver, true);
+
+        ASSERT_LT(sequential.defensive_solution.size(), second_step.size());
+        ASSERT_EQ(concurrent.defensive_solution, sequential.defensive_solution);
+        ASSERT_EQ(concurrent.offensive_solution, sequential.offensive_solution);
+        ASSERT_EQ(concurrent.defensive_utilization.getReservedEgressSlots(), sequential.defensive_utilization.getReservedEgressSlots());
+        ASSERT_EQ(concurrent.offensive_utilization.getReservedEgressSlots(), sequential.offensive_utilization.getReservedEgressSlots());
+    }
+
+    MultiLayeredGraph graph;
+    robin_hood::unordered_set<common::FlowNodeID> first_step;
+    robin_hood::unordered_set<common::FlowNodeID> second_step;
+};
+
+TEST_F(ConcurrentPlanningTest, first_fit)
+{
+    first_step = insertTraffic(800);
+    second_step = insertTraffic(800);
+
+    FirstFit first_fit(graph);
+    expectConcurrentMatchesSequential(first_fit);
+
+    FirstFit parallel_first_fit(graph, 4);
+    expectConcurrentMatchesSequential(parallel_first_fit);
+}
+
+TEST_F(ConcurrentPlanningTest, h2s)
+{
+    first_step = insertTraffic(800);
+    second_step = insertTraffic(800);
+
+    HierarchicalHeuristicScheduling h2s(graph, flow_sorting::FlowSorterTypes::LOW_PERIOD_FLOWS_FIRST,
+                                        configuration_rating::ConfigurationRatingTypes::PATH_LENGTH, placement::ConfigPlacementTypes::ASAP);
+    expectConcurrentMatchesSequential(h2s);
+}
+
+TEST_F(ConcurrentPlanningTest, portfolio)
+{
+    first_step = insertTraffic(800);
+    second_step = insertTraffic(800);
+
+    // ties are won by the faster scheduler, thus both schedulers have to find the same solution to be deterministic
+    std::vector<std::unique_ptr<solver::AbstractScheduler>> schedulers;
+    schedulers.emplace_back(std::make_unique<FirstFit>(graph));
+    schedulers.emplace_back(std::make_unique<FirstFit>(graph, 4));
+    Portfolio portfolio(std::move(schedulers));
+    expectConcurrentMatchesSequential(portfolio);
+}
+
+TEST_F(ConcurrentPlanningTest, supports_defensive_planning)
+{
+    const FirstFit first_fit(graph);
+    const EarliestDeadlineFirst edf(graph);
+    ASSERT_TRUE(first_fit.supportsDefensivePlanning());
+    ASSERT_TRUE(first_fit.clone()->supportsDefensivePlanning());
+    ASSERT_FALSE(edf.supportsDefensivePlanning());
+    ASSERT_FALSE(edf.clone()->supportsDefensivePlanning());
+
+    // a portfolio plans defensively only if all of its schedulers do
+    std::vector<std::unique_ptr<solver::AbstractScheduler>> schedulers;
+    schedulers.emplace_back(first_fit.clone());
+    const Portfolio defensive_portfolio(std::move(schedulers));
+    ASSERT_TRUE(defensive_portfolio.supportsDefensivePlanning());
+
+    schedulers.clear();
+    schedulers.emplace_back(first_fit.clone());
+    schedulers.emplace_back(edf.clone());
+    const Portfolio offensive_portfolio(std::move(schedulers));
+    ASSERT_FALSE(offensive_portfolio.supportsDefensivePlanning());
+    ASSERT_FALSE(offensive_portfolio.clone()->supportsDefensivePlanning());
+}
+
+TEST_F(ConcurrentPlanningTest, considers_all_configurations)
+{
+    const FirstFit first_fit(graph);
+    const HierarchicalHeuristicScheduling h2s(graph, flow_sorting::FlowSorterTypes::LOW_PERIOD_FLOWS_FIRST,
+                                              configuration_rating::ConfigurationRatingTypes::PATH_LENGTH, placement::ConfigPlacementTypes::ASAP);
+    ASSERT_FALSE(first_fit.considersAllConfigurations());
+    ASSERT_FALSE(first_fit.clone()->considersAllConfigurations());
+    ASSERT_TRUE(h2s.considersAllConfigurations());
+
+    // further configurations are generated for a portfolio if any of its schedulers considers them
+    std::vector<std::unique_ptr<solver::AbstractScheduler>> schedulers;
+    schedulers.emplace_back(first_fit.clone());
+    const Portfolio first_configuration_portfolio(std::move(schedulers));
+    ASSERT_FALSE(first_configuration_portfolio.considersAllConfigurations());
+
+    schedulers.clear();
+    schedulers.emplace_back(first_fit.clone());
+    schedulers.emplace_back(h2s.clone());
+    const Portfolio mixed_portfolio(std::move(schedulers));
+    ASSERT_TRUE(mixed_portfolio.considersAllConfigurations());
+}
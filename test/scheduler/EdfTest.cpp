@@ -20,7 +20,7 @@ protected:
     {
         routing::DijkstraOverlap navigator;
         const auto next_id = graph.getNumberOfFlows();
-        for(std::size_t i = next_id; i < next_id + number_of_flows; ++i) {
+        for(common::UnderlyingID i = next_id; i < next_id + number_of_flows; ++i) {
             const auto flow_id = common::FlowNodeID{i};
             constexpr auto source = common::NetworkNodeID{0};
             constexpr auto destination = common::NetworkNodeID{3};
@@ -110,4 +110,48 @@ TEST_F(EdfTest, trivial_fail_at_last_hop)
     // schedules all 65 flows with period 100
     // schedules only 63 flows with period 200
     ASSERT_EQ(result.size(), std::size_t{128});
-}
\ No newline at end of file
+}
+
+TEST_F(EdfTest, batch_admission)
+{
+    constexpr auto number_of_flows = std::size_t{65};
+    insertTraffic(number_of_flows, 100, 125);
+    insertTraffic(number_of_flows, 200, 125);
+    solver = std::make_unique<EarliestDeadlineFirst>(graph, true);
+
+    const auto result = run_edf(200);
+    // the batches are split until the flows not fitting are rejected one by one
+    ASSERT_EQ(result.size(), std::size_t{128});
+}
+
+TEST_F(EdfTest, checkpointed_admission_matches_simulation)
+{
+    // mixed periods that do not fit together, thus most flows are admitted one by one from the checkpoints
+    insertTraffic(40, 100, 250);
+    insertTraffic(30, 200, 375);
+    insertTraffic(20, 400, 500);
+
+    robin_hood::unordered_set<common::FlowNodeID> req_f;
+    for(const auto& element : graph.getFlows()) {
+        req_f.insert(element.first);
+    }
+    common::NetworkUtilizationList checkpointed_utilization(8, 400, 100);
+    const auto admitted = solver->solve(graph, {}, req_f, checkpointed_utilization);
+    ASSERT_GT(admitted.size(), 0);
+    ASSERT_LT(admitted.size(), req_f.size());
+
+    // the admitted flows fit into a single simulation from scratch, which has to reserve the same slots
+    robin_hood::unordered_set<common::FlowNodeID> admitted_f;
+    for(const auto& flow_id : admitted | std::views::keys) {
+        admitted_f.insert(flow_id);
+    }
+    EarliestDeadlineFirst from_scratch(graph);
+    common::NetworkUtilizationList simulated_utilization(8, 400, 100);
+    const auto simulated = from_scratch.solve(graph, {}, admitted_f, simulated_utilization);
+    ASSERT_EQ(simulated.size(), admitted.size());
+
+    check_reservation_overlaps(checkpointed_utilization);
+    checkpointed_utilization.sortReservedEgressSlots();
+    simulated_utilization.sortReservedEgressSlots();
+    ASSERT_EQ(checkpointed_utilization.getReservedEgressSlots(), simulated_utilization.getReservedEgressSlots());
+}
@@ -25,7 +25,7 @@ protected:
         routing::DijkstraOverlap navigator;
 
         const auto next_id = graph.getNumberOfFlows();
-        for(std::size_t i = next_id; i < next_id + number_of_flows; ++i) {
+        for(common::UnderlyingID i = next_id; i < next_id + number_of_flows; ++i) {
             auto flow_id = common::FlowNodeID{i};
 
             auto route = navigator.findRoutes(source, destination, graph, 1);
@@ -111,4 +111,47 @@ TEST_F(FirstFitTest, congestion)
 
     const auto result = run_ff(active_f, req_f, utilization);
     ASSERT_EQ(result.size(), number_of_congestion_load_flows + 5 + 2);
-}
\ No newline at end of file
+}
+
+TEST_F(FirstFitTest, parallel_matches_serial)
+{
+    auto step1 = insertTraffic(40, 500, 625, common::NetworkNodeID{0}, common::NetworkNodeID{3});
+    auto step2 = insertTraffic(30, 500, 1500, common::NetworkNodeID{1}, common::NetworkNodeID{2});
+    auto step3 = insertTraffic(30, 250, 125, common::NetworkNodeID{2}, common::NetworkNodeID{3});
+
+    robin_hood::unordered_set<common::FlowNodeID> req_f;
+    std::ranges::for_each(step1, [&](auto f) { req_f.insert(f); });
+    std::ranges::for_each(step2, [&](auto f) { req_f.insert(f); });
+    std::ranges::for_each(step3, [&](auto f) { req_f.insert(f); });
+
+    common::NetworkUtilizationList serial_utilization(graph.getNumberOfEgressQueues(), 500, 250);
+    const auto serial_result = solver->solve(graph, {}, req_f, serial_utilization);
+
+    solver = std::make_unique<FirstFit>(graph, 4);
+    common::NetworkUtilizationList parallel_utilization(graph.getNumberOfEgressQueues(), 500, 250);
+    const auto parallel_result = solver->solve(graph, {}, req_f, parallel_utilization);
+    check_reservation_overlaps(parallel_utilization);
+
+    ASSERT_LT(serial_result.size(), req_f.size());
+    ASSERT_EQ(parallel_result, serial_result);
+    ASSERT_EQ(parallel_utilization.getReservedEgressSlots(), serial_utilization.getReservedEgressSlots());
+}
+
+TEST_F(FirstFitTest, stop_requested)
+{
+    auto flows = insertTraffic(10, 1000, 500, common::NetworkNodeID{0}, common::NetworkNodeID{3});
+    robin_hood::unordered_set<common::FlowNodeID> req_f;
+    std::ranges::for_each(flows, [&](auto f) { req_f.insert(f); });
+
+    std::stop_source stop_source;
+    stop_source.request_stop();
+    common::NetworkUtilizationList stopped_utilization(graph.getNumberOfEgressQueues(), 1000, 1000);
+    const auto stopped_result = solver->solve(graph, {}, req_f, stopped_utilization, std::chrono::milliseconds{0}, stop_source.get_token());
+    ASSERT_TRUE(stopped_result.empty());
+    ASSERT_TRUE(solver->isStopped());
+
+    common::NetworkUtilizationList utilization(graph.getNumberOfEgressQueues(), 1000, 1000);
+    const auto result = solver->solve(graph, {}, req_f, utilization, std::chrono::milliseconds{1000});
+    ASSERT_EQ(result.size(), 10);
+    ASSERT_FALSE(solver->isStopped());
+}
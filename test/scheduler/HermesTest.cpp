@@ -6,7 +6,7 @@
 #include <gtest/gtest.h>
 
 
-auto insertTraffic(MultiLayeredGraph& graph, const std::size_t number_of_flows, const std::size_t source, const std::size_t destination,
+auto insertTraffic(MultiLayeredGraph& graph, const std::size_t number_of_flows, const common::UnderlyingID source, const common::UnderlyingID destination,
                    const std::size_t period, const std::size_t package_size)
     -> std::vector<common::FlowNodeID>
 {
@@ -14,7 +14,7 @@ auto insertTraffic(MultiLayeredGraph& graph, const std::size_t number_of_flows,
     inserted_flows.reserve(number_of_flows);
     routing::DijkstraOverlap navigator;
     const auto next_id = graph.getNumberOfFlows();
-    for(std::size_t i = next_id; i < next_id + number_of_flows; ++i) {
+    for(common::UnderlyingID i = next_id; i < next_id + number_of_flows; ++i) {
         const auto flow_id = common::FlowNodeID{i};
         const auto sourceID = common::NetworkNodeID{source};
         const auto destinationID = common::NetworkNodeID{destination};
@@ -0,0 +1,81 @@
+#include "IO/InputParser.h"
+#include "routing/DijkstraOverlap.h"
+#include "solver/scheduler/FirstFit.h"
+#include "solver/scheduler/HierarchicalHeuristicScheduling.h"
+#include "solver/scheduler/Portfolio.h"
+#include "util/UtilFunctions.h"
+
+#include <gtest/gtest.h>
+#include <testUtil.h>
+
+class PortfolioTest : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        const auto* const network_graph_path = "../../test/test_data/star.txt";
+        graph = io::parseNetworkGraph(network_graph_path).value();
+    }
+
+    auto insertTraffic(const std::size_t number_of_flows, const std::size_t period, const std::size_t package_size) -> void
+    {
+        routing::DijkstraOverlap navigator;
+        const auto next_id = graph.getNumberOfFlows();
+        for(common::UnderlyingID i = next_id; i < next_id + number_of_flows; ++i) {
+            const auto flow_id = common::FlowNodeID{i};
+            constexpr auto source = common::NetworkNodeID{0};
+            constexpr auto destination = common::NetworkNodeID{3};
+
+            auto route = navigator.findRoutes(source, destination, graph, 1);
+            auto config_id = graph.insertConfiguration(flow_id, route.front());
+
+            const auto flow = graph_structs::Flow{
+                .id = flow_id,
+                .frame_size = package_size,
+                .period = period,
+                .source = source,
+                .destination = destination,
+                .configurations = {config_id}};
+            graph.addFlow(flow);
+        }
+    }
+
+    auto run(solver::AbstractScheduler& solver) -> solver::solutionSet
+    {
+        robin_hood::unordered_set<common::FlowNodeID> req_f;
+        for(const auto& element : graph.getFlows()) {
+            req_f.insert(element.first);
+        }
+        common::NetworkUtilizationList utilization(graph.getNumberOfEgressQueues(), 500, 250);
+        auto result = solver.solve(graph, {}, req_f, utilization);
+        check_reservation_overlaps(utilization);
+        return result;
+    }
+
+    MultiLayeredGraph graph;
+};
+
+TEST_F(PortfolioTest, highest_traffic_wins)
+{
+    // large frames first: FirstFit adds flows by ID, H2S prefers the low period flows
+    insertTraffic(4, 500, 6250);
+    insertTraffic(20, 250, 625);
+
+    FirstFit first_fit(graph);
+    HierarchicalHeuristicScheduling h2s(graph, flow_sorting::FlowSorterTypes::LOW_PERIOD_FLOWS_FIRST,
+                                        configuration_rating::ConfigurationRatingTypes::PATH_LENGTH, placement::ConfigPlacementTypes::ASAP);
+    const auto first_fit_traffic = util::calculate_ingress_traffic(run(first_fit), graph);
+    const auto h2s_traffic = util::calculate_ingress_traffic(run(h2s), graph);
+
+    ASSERT_NE(first_fit_traffic, h2s_traffic);
+
+    std::vector<std::unique_ptr<solver::AbstractScheduler>> schedulers;
+    schedulers.emplace_back(std::make_unique<FirstFit>(graph));
+    schedulers.emplace_back(std::make_unique<HierarchicalHeuristicScheduling>(graph, flow_sorting::FlowSorterTypes::LOW_PERIOD_FLOWS_FIRST,
+                                                                              configuration_rating::ConfigurationRatingTypes::PATH_LENGTH,
+                                                                              placement::ConfigPlacementTypes::ASAP));
+    Portfolio portfolio(std::move(schedulers));
+
+    const auto portfolio_traffic = util::calculate_ingress_traffic(run(portfolio), graph);
+    ASSERT_EQ(portfolio_traffic, std::max(first_fit_traffic, h2s_traffic));
+}
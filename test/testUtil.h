@@ -26,7 +26,7 @@ inline auto print_route(const std::vector<common::NetworkQueueID>& route, MultiL
 
 inline auto print_egress_queue_to_link_mapping(const MultiLayeredGraph& graph) -> void
 {
-    for(std::size_t i = 0; i < graph.getNumberOfNetworkNodes(); ++i) {
+    for(common::UnderlyingID i = 0; i < graph.getNumberOfNetworkNodes(); ++i) {
         auto id = common::NetworkNodeID{i};
         for(const auto& egress_port : graph.getEgressQueuesOf(id)) {
             fmt::print("link {}-{}\tPort: {}\n", id.get(), egress_port.destination.get(), egress_port.id.get());